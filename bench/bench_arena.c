@@ -0,0 +1,113 @@
+#include "bench_arena.h"
+
+#include <cemb/arena.h>
+#include <cemb/static_pool.h>
+
+#define BENCH_MAX_OBJECT_COUNT (4096)
+#define BENCH_OBJECT_SIZE (32)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_OBJECT_COUNT};
+
+static _Alignas(max_align_t) uint8_t bench_buffer[BENCH_MAX_OBJECT_COUNT * BENCH_OBJECT_SIZE];
+
+/**
+ * @brief A request's temporaries are allocated, then all released with a single reset to a mark.
+ */
+static void bench_allocate_reset(BenchRunner_t * runner, size_t object_count)
+{
+    Arena_t arena;
+    ArenaMark_t mark;
+    ArenaConfig_t config = {
+        .buffer = bench_buffer,
+        .buffer_size = sizeof(bench_buffer),
+        .block_allocator = NULL,
+        .block_size = 0,
+    };
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+
+    arena_init(&arena, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t reset_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        arena_mark(&arena, &mark);
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            arena_allocate(&arena, BENCH_OBJECT_SIZE, sizeof(void *), &objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        arena_reset_to_mark(&arena, &mark);
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        reset_ns += end - middle;
+    }
+
+    arena_deinit(&arena);
+
+    BenchResult_t allocate_result = {"arena", "allocate", object_count, rounds * object_count, allocate_ns};
+    BenchResult_t reset_result = {"arena", "reset_to_mark", object_count, rounds * object_count, reset_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &reset_result);
+}
+
+/**
+ * @brief The same temporaries from a static pool, which must free each one.
+ */
+static void bench_static_pool_allocate_deallocate(BenchRunner_t * runner, size_t object_count)
+{
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+    StaticPool_t pool;
+    StaticPoolConfig_t config = {
+        .allocation_stack = NULL,
+        .buffer = bench_buffer,
+        .buffer_size = sizeof(bench_buffer),
+        .object_size = BENCH_OBJECT_SIZE,
+        .object_count = object_count,
+    };
+
+    static_pool_init(&pool, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            static_pool_allocate(&pool, &objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            static_pool_deallocate(&pool, &objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    static_pool_deinit(&pool);
+
+    BenchResult_t allocate_result = {"arena", "static_pool_allocate", object_count, rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"arena", "static_pool_deallocate", object_count, rounds * object_count,
+                                       deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+void bench_arena_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_allocate_reset(runner, bench_sizes[idx]);
+        bench_static_pool_allocate_deallocate(runner, bench_sizes[idx]);
+    }
+}
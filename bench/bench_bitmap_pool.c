@@ -0,0 +1,63 @@
+#include "bench_bitmap_pool.h"
+
+#include <cemb/bitmap_pool.h>
+
+#define BENCH_MAX_OBJECT_COUNT (4096)
+#define BENCH_OBJECT_SIZE (32)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_OBJECT_COUNT};
+
+static void bench_allocate_deallocate(BenchRunner_t * runner, size_t object_count)
+{
+    static uint8_t buffer[BENCH_MAX_OBJECT_COUNT * BENCH_OBJECT_SIZE];
+    static uint32_t bitmap[BITMAP_POOL_BITMAP_WORD_COUNT(BENCH_MAX_OBJECT_COUNT)];
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+    BitmapPool_t pool;
+    BitmapPoolConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = BENCH_OBJECT_SIZE,
+        .object_count = object_count,
+        .bitmap = bitmap,
+        .bitmap_word_count = BITMAP_POOL_BITMAP_WORD_COUNT(BENCH_MAX_OBJECT_COUNT),
+    };
+
+    bitmap_pool_init(&pool, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            bitmap_pool_allocate(&pool, &objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            bitmap_pool_deallocate(&pool, &objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    bitmap_pool_deinit(&pool);
+
+    BenchResult_t allocate_result = {"bitmap_pool", "allocate", object_count, rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"bitmap_pool", "deallocate", object_count, rounds * object_count, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+void bench_bitmap_pool_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_allocate_deallocate(runner, bench_sizes[idx]);
+    }
+}
@@ -0,0 +1,200 @@
+#include "bench_bounded_heap.h"
+
+#include <cemb/bounded_heap.h>
+#include <cemb/cache_line.h>
+
+#define BENCH_MAX_HEAP_SIZE (65536)
+#define BENCH_STORAGE_OFFSET ((CEMB_CACHE_LINE_SIZE / sizeof(void *)) - 1)
+
+static size_t const bench_sizes[] = {16, 256, 4096, BENCH_MAX_HEAP_SIZE};
+
+/**
+ * @brief Min heap compare, values are stored directly in the pointers.
+ */
+static bool bench_min_heap_compare(void const * const parent, void const * const child)
+{
+    return (uintptr_t)parent > (uintptr_t)child;
+}
+
+/**
+ * @brief Cheap pseudo random sequence so the heap sees unordered keys without pulling in rand().
+ */
+static uint32_t bench_next_key(uint32_t * state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Pushes then pops heap_size keys, the storage is offset so every group of siblings starts on a cache line.
+ */
+static void bench_push_pop(BenchRunner_t * runner, size_t heap_size, size_t arity, char const * push_name,
+                           char const * pop_name)
+{
+    static _Alignas(CEMB_CACHE_LINE_SIZE) void * storage[BENCH_STORAGE_OFFSET + BENCH_MAX_HEAP_SIZE];
+    BoundedHeap_t heap;
+    BoundedHeapConfig_t config = {
+        .heap_storage = &storage[BENCH_STORAGE_OFFSET],
+        .element_count = heap_size,
+        .compare = bench_min_heap_compare,
+        .arity = arity,
+    };
+
+    bounded_heap_init(&heap, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, heap_size);
+    uint64_t push_ns = 0;
+    uint64_t pop_ns = 0;
+    uint32_t key_state = 0x12345678u;
+    void * item = NULL;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bounded_heap_push(&heap, (void *)(uintptr_t)bench_next_key(&key_state));
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bounded_heap_pop(&heap, &item);
+            checksum += (uintptr_t)item;
+        }
+        uint64_t end = bench_get_time_ns();
+
+        push_ns += middle - start;
+        pop_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    bounded_heap_deinit(&heap);
+
+    BenchResult_t push_result = {"bounded_heap", push_name, heap_size, rounds * heap_size, push_ns};
+    BenchResult_t pop_result = {"bounded_heap", pop_name, heap_size, rounds * heap_size, pop_ns};
+    bench_runner_report(runner, &push_result);
+    bench_runner_report(runner, &pop_result);
+}
+
+/**
+ * @brief Loads heap_size unordered keys with one bottom up build, compare with the push row for loading them one at a
+ *        time. Ops are items loaded.
+ */
+static void bench_build(BenchRunner_t * runner, size_t heap_size)
+{
+    static void * storage[BENCH_MAX_HEAP_SIZE];
+    static void * keys[BENCH_MAX_HEAP_SIZE];
+    BoundedHeap_t heap;
+    BoundedHeapConfig_t config = {
+        .heap_storage = storage,
+        .element_count = heap_size,
+        .compare = bench_min_heap_compare,
+    };
+
+    bounded_heap_init(&heap, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, heap_size);
+    uint64_t build_ns = 0;
+    uint32_t key_state = 0x12345678u;
+    void * item = NULL;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            keys[idx] = (void *)(uintptr_t)bench_next_key(&key_state);
+        }
+
+        uint64_t start = bench_get_time_ns();
+        bounded_heap_build(&heap, keys, heap_size);
+        uint64_t end = bench_get_time_ns();
+        build_ns += end - start;
+
+        bounded_heap_peek(&heap, &item);
+        bench_consume((uintptr_t)item);
+        bounded_heap_deinit(&heap);
+        bounded_heap_init(&heap, &config);
+    }
+
+    bounded_heap_deinit(&heap);
+
+    BenchResult_t build_result = {"bounded_heap", "build", heap_size, rounds * heap_size, build_ns};
+    bench_runner_report(runner, &build_result);
+}
+
+/**
+ * @brief Swaps the root of a full heap for a new key, as a pop then a push, a pushpop, and a replace top. Ops are
+ *        swaps.
+ */
+static void bench_swap_root(BenchRunner_t * runner, size_t heap_size)
+{
+    static void * storage[BENCH_MAX_HEAP_SIZE];
+    BoundedHeap_t heap;
+    BoundedHeapConfig_t config = {
+        .heap_storage = storage,
+        .element_count = heap_size,
+        .compare = bench_min_heap_compare,
+    };
+    uint64_t swap_ns[3] = {0};
+    char const * const swap_names[] = {"pop_push", "pushpop", "replace_top"};
+    uint64_t swap_count = bench_runner_get_rounds(runner, 1);
+
+    for (size_t method = 0; method < 3; ++method)
+    {
+        uint32_t key_state = 0x12345678u;
+        void * item = NULL;
+        uintptr_t checksum = 0;
+
+        bounded_heap_init(&heap, &config);
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bounded_heap_push(&heap, (void *)(uintptr_t)bench_next_key(&key_state));
+        }
+
+        uint64_t start = bench_get_time_ns();
+        for (uint64_t swap = 0; swap < swap_count; ++swap)
+        {
+            void * key = (void *)(uintptr_t)bench_next_key(&key_state);
+            if (method == 0)
+            {
+                bounded_heap_pop(&heap, &item);
+                bounded_heap_push(&heap, key);
+            }
+            else if (method == 1)
+            {
+                bounded_heap_pushpop(&heap, key, &item);
+            }
+            else
+            {
+                bounded_heap_replace_top(&heap, key, &item);
+            }
+            checksum += (uintptr_t)item;
+        }
+        uint64_t end = bench_get_time_ns();
+        swap_ns[method] = end - start;
+        bench_consume(checksum);
+
+        bounded_heap_deinit(&heap);
+    }
+
+    for (size_t method = 0; method < 3; ++method)
+    {
+        BenchResult_t result = {"bounded_heap", swap_names[method], heap_size, swap_count, swap_ns[method]};
+        bench_runner_report(runner, &result);
+    }
+}
+
+void bench_bounded_heap_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_push_pop(runner, bench_sizes[idx], 2, "push", "pop");
+        bench_push_pop(runner, bench_sizes[idx], 4, "push_4ary", "pop_4ary");
+        bench_push_pop(runner, bench_sizes[idx], 8, "push_8ary", "pop_8ary");
+        bench_build(runner, bench_sizes[idx]);
+        bench_swap_root(runner, bench_sizes[idx]);
+    }
+}
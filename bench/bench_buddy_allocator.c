@@ -0,0 +1,159 @@
+#include "bench_buddy_allocator.h"
+
+#include <cemb/buddy_allocator.h>
+#include <cemb/static_pool.h>
+
+#include <stdlib.h>
+
+#define BENCH_MAX_OBJECT_COUNT (1024)
+#define BENCH_MIN_BLOCK_SIZE (64)
+#define BENCH_MAX_BLOCK_SIZE (2048)
+#define BENCH_BUFFER_SIZE (BENCH_MAX_OBJECT_COUNT * BENCH_MAX_BLOCK_SIZE)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_OBJECT_COUNT};
+
+static _Alignas(BENCH_MIN_BLOCK_SIZE) uint8_t bench_buffer[BENCH_BUFFER_SIZE];
+static uint32_t bench_bitmap[BUDDY_ALLOCATOR_BITMAP_WORD_COUNT(BENCH_BUFFER_SIZE, BENCH_MIN_BLOCK_SIZE)];
+static void * bench_objects[BENCH_MAX_OBJECT_COUNT];
+
+/**
+ * @brief Gets the request size of an object, all the minimum block size, or packet like sizes from 64 to 2048 bytes.
+ */
+static inline size_t bench_get_request_size(size_t idx, bool mixed)
+{
+    return mixed ? ((BENCH_MIN_BLOCK_SIZE << (idx % 6)) - (idx % 7)) : BENCH_MIN_BLOCK_SIZE;
+}
+
+static void bench_buddy_allocate_deallocate(BenchRunner_t * runner, size_t object_count, bool mixed)
+{
+    BuddyAllocator_t buddy;
+    BuddyAllocatorConfig_t config = {
+        .buffer = bench_buffer,
+        .buffer_size = sizeof(bench_buffer),
+        .min_block_size = BENCH_MIN_BLOCK_SIZE,
+        .bitmap = bench_bitmap,
+        .bitmap_word_count = sizeof(bench_bitmap) / sizeof(bench_bitmap[0]),
+    };
+
+    buddy_allocator_init(&buddy, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            buddy_allocator_allocate(&buddy, bench_get_request_size(idx, mixed), &bench_objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            buddy_allocator_deallocate(&buddy, &bench_objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    buddy_allocator_deinit(&buddy);
+
+    BenchResult_t allocate_result = {"buddy_allocator", mixed ? "allocate_mixed" : "allocate", object_count,
+                                     rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"buddy_allocator", mixed ? "deallocate_mixed" : "deallocate", object_count,
+                                       rounds * object_count, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+static void bench_static_pool_allocate_deallocate(BenchRunner_t * runner, size_t object_count)
+{
+    StaticPool_t pool;
+    StaticPoolConfig_t config = {
+        .allocation_stack = NULL,
+        .buffer = bench_buffer,
+        .buffer_size = object_count * BENCH_MIN_BLOCK_SIZE,
+        .object_size = BENCH_MIN_BLOCK_SIZE,
+        .object_count = object_count,
+    };
+
+    static_pool_init(&pool, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            static_pool_allocate(&pool, &bench_objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            static_pool_deallocate(&pool, &bench_objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    static_pool_deinit(&pool);
+
+    BenchResult_t allocate_result = {"buddy_allocator", "static_pool_allocate", object_count, rounds * object_count,
+                                     allocate_ns};
+    BenchResult_t deallocate_result = {"buddy_allocator", "static_pool_deallocate", object_count, rounds * object_count,
+                                       deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+static void bench_malloc_free(BenchRunner_t * runner, size_t object_count, bool mixed)
+{
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            bench_objects[idx] = malloc(bench_get_request_size(idx, mixed));
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            free(bench_objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    BenchResult_t allocate_result = {"buddy_allocator", mixed ? "malloc_mixed" : "malloc", object_count,
+                                     rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"buddy_allocator", mixed ? "free_mixed" : "free", object_count,
+                                       rounds * object_count, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+void bench_buddy_allocator_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_buddy_allocate_deallocate(runner, bench_sizes[idx], false);
+        bench_static_pool_allocate_deallocate(runner, bench_sizes[idx]);
+        bench_malloc_free(runner, bench_sizes[idx], false);
+        bench_buddy_allocate_deallocate(runner, bench_sizes[idx], true);
+        bench_malloc_free(runner, bench_sizes[idx], true);
+    }
+}
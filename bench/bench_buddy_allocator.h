@@ -0,0 +1,5 @@
+#pragma once
+
+#include "bench_common.h"
+
+void bench_buddy_allocator_run(BenchRunner_t * runner);
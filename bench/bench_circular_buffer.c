@@ -0,0 +1,104 @@
+#include "bench_circular_buffer.h"
+
+#include <cemb/circular_buffer.h>
+
+#define BENCH_MAX_BUFFER_SIZE (4096)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_BUFFER_SIZE};
+
+static void bench_push_pop_byte(BenchRunner_t * runner, size_t buffer_size)
+{
+    static uint8_t storage[BENCH_MAX_BUFFER_SIZE];
+    CircularBuffer_t buffer;
+    CircularBufferConfig_t config = {
+        .buffer = storage,
+        .buffer_size = buffer_size,
+    };
+
+    circular_buffer_init(&buffer, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, buffer_size);
+    uint64_t push_ns = 0;
+    uint64_t pop_ns = 0;
+    uint8_t byte = 0;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < buffer_size; ++idx)
+        {
+            circular_buffer_push_byte(&buffer, (uint8_t)idx);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < buffer_size; ++idx)
+        {
+            circular_buffer_pop_byte(&buffer, &byte);
+            checksum += byte;
+        }
+        uint64_t end = bench_get_time_ns();
+
+        push_ns += middle - start;
+        pop_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    circular_buffer_deinit(&buffer);
+
+    BenchResult_t push_result = {"circular_buffer", "push_byte", buffer_size, rounds * buffer_size, push_ns};
+    BenchResult_t pop_result = {"circular_buffer", "pop_byte", buffer_size, rounds * buffer_size, pop_ns};
+    bench_runner_report(runner, &push_result);
+    bench_runner_report(runner, &pop_result);
+}
+
+/**
+ * @brief Moves data through the buffer in blocks, ops are bytes so the results compare directly with the byte API.
+ */
+static void bench_push_pop_block(BenchRunner_t * runner, size_t buffer_size)
+{
+    static uint8_t storage[BENCH_MAX_BUFFER_SIZE];
+    static uint8_t block[BENCH_MAX_BUFFER_SIZE];
+    CircularBuffer_t buffer;
+    CircularBufferConfig_t config = {
+        .buffer = storage,
+        .buffer_size = buffer_size,
+    };
+
+    circular_buffer_init(&buffer, &config);
+
+    // blocks that do not divide the buffer size, so most transfers are split at the wrap point
+    size_t block_size = (buffer_size / 2) + 1;
+    uint64_t rounds = bench_runner_get_rounds(runner, block_size);
+    uint64_t push_ns = 0;
+    uint64_t pop_ns = 0;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        circular_buffer_push(&buffer, block, block_size);
+        uint64_t middle = bench_get_time_ns();
+        checksum += circular_buffer_pop(&buffer, block, block_size);
+        uint64_t end = bench_get_time_ns();
+
+        push_ns += middle - start;
+        pop_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    circular_buffer_deinit(&buffer);
+
+    BenchResult_t push_result = {"circular_buffer", "push_block", buffer_size, rounds * block_size, push_ns};
+    BenchResult_t pop_result = {"circular_buffer", "pop_block", buffer_size, rounds * block_size, pop_ns};
+    bench_runner_report(runner, &push_result);
+    bench_runner_report(runner, &pop_result);
+}
+
+void bench_circular_buffer_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_push_pop_byte(runner, bench_sizes[idx]);
+        bench_push_pop_block(runner, bench_sizes[idx]);
+    }
+}
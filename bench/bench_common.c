@@ -0,0 +1,85 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench_common.h"
+
+#include <assert.h>
+#include <time.h>
+
+static volatile uintptr_t bench_sink;
+
+uint64_t bench_get_time_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+void bench_consume(uintptr_t value)
+{
+    bench_sink = value;
+}
+
+void bench_runner_init(BenchRunner_t * runner, BenchOutputFormat_t format, FILE * stream, uint64_t target_ops)
+{
+    assert(runner);
+    assert(stream);
+
+    runner->format = format;
+    runner->stream = stream;
+    runner->target_ops = target_ops;
+    runner->result_count = 0;
+
+    if (runner->format == BENCH_OUTPUT_FORMAT_CSV)
+    {
+        fprintf(runner->stream, "suite,name,size,ops,elapsed_ns,ns_per_op,ops_per_sec\n");
+    }
+    else
+    {
+        fprintf(runner->stream, "{\n  \"results\": [");
+    }
+}
+
+void bench_runner_deinit(BenchRunner_t * runner)
+{
+    assert(runner);
+
+    if (runner->format == BENCH_OUTPUT_FORMAT_JSON)
+    {
+        fprintf(runner->stream, "\n  ]\n}\n");
+    }
+    fflush(runner->stream);
+}
+
+uint64_t bench_runner_get_rounds(BenchRunner_t const * runner, size_t round_size)
+{
+    assert(runner);
+    assert(round_size > 0);
+
+    uint64_t rounds = runner->target_ops / round_size;
+    return (rounds == 0) ? 1 : rounds;
+}
+
+void bench_runner_report(BenchRunner_t * runner, BenchResult_t const * result)
+{
+    assert(runner);
+    assert(result);
+
+    // guard against a zero elapsed time from a coarse clock
+    uint64_t elapsed_ns = (result->elapsed_ns == 0) ? 1 : result->elapsed_ns;
+    double ns_per_op = (double)elapsed_ns / (double)result->ops;
+    double ops_per_sec = ((double)result->ops * 1e9) / (double)elapsed_ns;
+
+    if (runner->format == BENCH_OUTPUT_FORMAT_CSV)
+    {
+        fprintf(runner->stream, "%s,%s,%zu,%llu,%llu,%.3f,%.0f\n", result->suite, result->name, result->size,
+                (unsigned long long)result->ops, (unsigned long long)elapsed_ns, ns_per_op, ops_per_sec);
+    }
+    else
+    {
+        fprintf(runner->stream, "%s\n    {\"suite\": \"%s\", \"name\": \"%s\", \"size\": %zu, \"ops\": %llu, "
+                "\"elapsed_ns\": %llu, \"ns_per_op\": %.3f, \"ops_per_sec\": %.0f}",
+                (runner->result_count == 0) ? "" : ",", result->suite, result->name, result->size,
+                (unsigned long long)result->ops, (unsigned long long)elapsed_ns, ns_per_op, ops_per_sec);
+    }
+    runner->result_count++;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file
+ * @brief Common timing and reporting helpers shared by all the benchmarks.
+ *
+ * Each benchmark measures a number of operations and reports the elapsed time through a #BenchRunner, which formats
+ * results as either CSV or JSON so they can be collected and compared between releases.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+typedef struct BenchRunner BenchRunner_t;
+typedef struct BenchResult BenchResult_t;
+
+/**
+ * @brief Output formats supported by the #BenchRunner.
+ */
+typedef enum BenchOutputFormat
+{
+    BENCH_OUTPUT_FORMAT_CSV,
+    BENCH_OUTPUT_FORMAT_JSON,
+} BenchOutputFormat_t;
+
+/**
+ * @brief A single benchmark measurement.
+ */
+struct BenchResult
+{
+    char const * suite; /**< The module being measured, e.g. "circular_buffer". */
+    char const * name; /**< The operation being measured, e.g. "push_byte". */
+    size_t size; /**< The size parameter for this run (capacity, element count, etc.), meaning depends on the suite. */
+    uint64_t ops; /**< Number of operations performed. */
+    uint64_t elapsed_ns; /**< Total time taken to perform all the operations. */
+};
+
+/**
+ * @brief Runs and reports benchmarks.
+ */
+struct BenchRunner
+{
+    BenchOutputFormat_t format;
+    FILE * stream;
+    uint64_t target_ops; /**< Approximate number of operations each benchmark should perform. */
+    size_t result_count;
+};
+
+/**
+ * @brief Gets a monotonic timestamp.
+ *
+ * @returns The current monotonic time in nanoseconds.
+ */
+uint64_t bench_get_time_ns(void);
+
+/**
+ * @brief Stores a value in a sink the compiler cannot optimise away, used to keep benchmarked results alive.
+ *
+ * @param[in] value - the value to consume
+ */
+void bench_consume(uintptr_t value);
+
+/**
+ * @brief Initialises the runner and writes any output preamble.
+ *
+ * @param[in] runner - the runner
+ * @param[in] format - the output format
+ * @param[in] stream - the stream to write results to
+ * @param[in] target_ops - approximate number of operations each benchmark should perform
+ *
+ * @memberof BenchRunner
+ */
+void bench_runner_init(BenchRunner_t * runner, BenchOutputFormat_t format, FILE * stream, uint64_t target_ops);
+
+/**
+ * @brief Writes any output postamble. No results may be reported after this call.
+ *
+ * @param[in] runner - the runner
+ *
+ * @memberof BenchRunner
+ */
+void bench_runner_deinit(BenchRunner_t * runner);
+
+/**
+ * @brief Gets the number of rounds to run for a benchmark which performs round_size operations per round.
+ *
+ * @param[in] runner - the runner
+ * @param[in] round_size - the number of operations in a single round
+ *
+ * @returns Number of rounds, always at least 1.
+ *
+ * @memberof BenchRunner
+ */
+uint64_t bench_runner_get_rounds(BenchRunner_t const * runner, size_t round_size);
+
+/**
+ * @brief Reports a single result.
+ *
+ * @param[in] runner - the runner
+ * @param[in] result - the result to report
+ *
+ * @memberof BenchRunner
+ */
+void bench_runner_report(BenchRunner_t * runner, BenchResult_t const * result);
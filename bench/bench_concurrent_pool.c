@@ -0,0 +1,161 @@
+#include "bench_concurrent_pool.h"
+
+#include <cemb/concurrent_pool.h>
+#include <cemb/static_pool.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#define BENCH_OBJECT_COUNT (1024)
+#define BENCH_OBJECT_SIZE (32)
+#define BENCH_MAX_THREADS (8)
+#define BENCH_OBJECTS_HELD_PER_THREAD (4)
+
+/**
+ * Sizes are the number of threads sharing the pool.
+ */
+static size_t const bench_thread_counts[] = {1, 2, 4, BENCH_MAX_THREADS};
+
+/**
+ * @brief A static pool with a global mutex, which is the baseline the lock free pool replaces.
+ */
+typedef struct BenchLockedPool BenchLockedPool_t;
+
+struct BenchLockedPool
+{
+    StaticPool_t pool;
+    pthread_mutex_t lock;
+};
+
+static ErrorCode_t bench_locked_pool_allocate(BenchLockedPool_t * locked, void ** object_ptr)
+{
+    pthread_mutex_lock(&locked->lock);
+    ErrorCode_t ret = static_pool_allocate(&locked->pool, object_ptr);
+    pthread_mutex_unlock(&locked->lock);
+    return ret;
+}
+
+static ErrorCode_t bench_locked_pool_deallocate(BenchLockedPool_t * locked, void ** object_ptr)
+{
+    pthread_mutex_lock(&locked->lock);
+    ErrorCode_t ret = static_pool_deallocate(&locked->pool, object_ptr);
+    pthread_mutex_unlock(&locked->lock);
+    return ret;
+}
+
+static size_t bench_locked_pool_get_available_count(BenchLockedPool_t * locked)
+{
+    pthread_mutex_lock(&locked->lock);
+    size_t count = static_pool_get_available_count(&locked->pool);
+    pthread_mutex_unlock(&locked->lock);
+    return count;
+}
+
+typedef struct BenchPoolArgs BenchPoolArgs_t;
+
+/**
+ * @brief Per thread arguments, both pools are driven through the allocator interface so the loop is identical.
+ */
+struct BenchPoolArgs
+{
+    IPoolAllocator_t const * allocator;
+    uint64_t round_count;
+};
+
+static void * bench_pool_thread(void * context)
+{
+    BenchPoolArgs_t * args = context;
+    void * held[BENCH_OBJECTS_HELD_PER_THREAD];
+
+    for (uint64_t round = 0; round < args->round_count; ++round)
+    {
+        for (size_t idx = 0; idx < BENCH_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            while (i_pool_allocator_allocate(args->allocator, &held[idx]) != ERR_NONE)
+            {
+                sched_yield();
+            }
+        }
+        for (size_t idx = 0; idx < BENCH_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            i_pool_allocator_deallocate(args->allocator, &held[idx]);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs the threads against the allocator, ops are allocate plus deallocate pairs.
+ */
+static void bench_threaded(BenchRunner_t * runner, IPoolAllocator_t const * allocator, char const * name,
+                           size_t thread_count)
+{
+    BenchPoolArgs_t args[BENCH_MAX_THREADS];
+    pthread_t threads[BENCH_MAX_THREADS];
+
+    // the total work is fixed, so ops/sec shows how throughput scales with the thread count
+    uint64_t round_count = bench_runner_get_rounds(runner, thread_count * BENCH_OBJECTS_HELD_PER_THREAD);
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        args[idx] = (BenchPoolArgs_t){allocator, round_count};
+    }
+
+    uint64_t start = bench_get_time_ns();
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        pthread_create(&threads[idx], NULL, bench_pool_thread, &args[idx]);
+    }
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        pthread_join(threads[idx], NULL);
+    }
+    uint64_t end = bench_get_time_ns();
+
+    BenchResult_t result = {"concurrent_pool", name, thread_count,
+                            round_count * thread_count * BENCH_OBJECTS_HELD_PER_THREAD, end - start};
+    bench_runner_report(runner, &result);
+}
+
+void bench_concurrent_pool_run(BenchRunner_t * runner)
+{
+    static uint8_t buffer[BENCH_OBJECT_COUNT * BENCH_OBJECT_SIZE];
+    static atomic_size_t link_buffer[BENCH_OBJECT_COUNT];
+    static void * allocation_stack[BENCH_OBJECT_COUNT];
+    ConcurrentPool_t concurrent;
+    BenchLockedPool_t locked;
+    IPoolAllocator_t concurrent_allocator;
+    IPoolAllocator_t locked_allocator = {
+        .context = &locked,
+        .allocate = (i_pool_allocate_allocate_t)bench_locked_pool_allocate,
+        .deallocate = (i_pool_allocate_deallocate_t)bench_locked_pool_deallocate,
+        .get_available_count = (i_pool_allocate_get_available_count_t)bench_locked_pool_get_available_count,
+    };
+    ConcurrentPoolConfig_t concurrent_config = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = BENCH_OBJECT_SIZE,
+        .object_count = BENCH_OBJECT_COUNT,
+        .link_buffer = link_buffer,
+    };
+    StaticPoolConfig_t locked_config = {
+        .allocation_stack = allocation_stack,
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = BENCH_OBJECT_SIZE,
+        .object_count = BENCH_OBJECT_COUNT,
+    };
+
+    for (size_t idx = 0; idx < sizeof(bench_thread_counts) / sizeof(bench_thread_counts[0]); ++idx)
+    {
+        concurrent_pool_init(&concurrent, &concurrent_config);
+        concurrent_pool_as_i_pool_allocator(&concurrent, &concurrent_allocator);
+        bench_threaded(runner, &concurrent_allocator, "threaded_allocate_deallocate", bench_thread_counts[idx]);
+        concurrent_pool_deinit(&concurrent);
+
+        static_pool_init(&locked.pool, &locked_config);
+        pthread_mutex_init(&locked.lock, NULL);
+        bench_threaded(runner, &locked_allocator, "threaded_allocate_deallocate_mutex", bench_thread_counts[idx]);
+        pthread_mutex_destroy(&locked.lock);
+        static_pool_deinit(&locked.pool);
+    }
+}
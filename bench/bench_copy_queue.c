@@ -0,0 +1,188 @@
+#include "bench_copy_queue.h"
+
+#include <cemb/copy_queue.h>
+
+#define BENCH_MAX_ELEMENT_COUNT (4096)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_ELEMENT_COUNT};
+
+static void bench_enqueue_dequeue(BenchRunner_t * runner, size_t element_count)
+{
+    static uint32_t storage[BENCH_MAX_ELEMENT_COUNT];
+    CopyQueue_t queue;
+    CopyQueueConfig_t config = {
+        .queue_buffer = (uint8_t *)storage,
+        .queue_size = sizeof(storage),
+        .element_count = element_count,
+        .element_size = sizeof(uint32_t),
+    };
+
+    copy_queue_init(&queue, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, element_count);
+    uint64_t enqueue_ns = 0;
+    uint64_t dequeue_ns = 0;
+    uint32_t element = 0;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (uint32_t idx = 0; idx < element_count; ++idx)
+        {
+            copy_queue_enqueue(&queue, &idx);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < element_count; ++idx)
+        {
+            copy_queue_dequeue(&queue, &element);
+            checksum += element;
+        }
+        uint64_t end = bench_get_time_ns();
+
+        enqueue_ns += middle - start;
+        dequeue_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    copy_queue_deinit(&queue);
+
+    BenchResult_t enqueue_result = {"copy_queue", "enqueue_u32", element_count, rounds * element_count, enqueue_ns};
+    BenchResult_t dequeue_result = {"copy_queue", "dequeue_u32", element_count, rounds * element_count, dequeue_ns};
+    bench_runner_report(runner, &enqueue_result);
+    bench_runner_report(runner, &dequeue_result);
+}
+
+/**
+ * @brief Moves elements through the queue in batches, ops are elements so the results compare directly with the
+ * single element API.
+ */
+static void bench_enqueue_dequeue_n(BenchRunner_t * runner, size_t element_count)
+{
+    static uint32_t storage[BENCH_MAX_ELEMENT_COUNT];
+    static uint32_t batch[BENCH_MAX_ELEMENT_COUNT];
+    CopyQueue_t queue;
+    CopyQueueConfig_t config = {
+        .queue_buffer = (uint8_t *)storage,
+        .queue_size = sizeof(storage),
+        .element_count = element_count,
+        .element_size = sizeof(uint32_t),
+    };
+
+    copy_queue_init(&queue, &config);
+
+    // batches that do not divide the queue size, so most batches are split at the wrap point
+    size_t batch_count = (element_count / 2) + 1;
+    uint64_t rounds = bench_runner_get_rounds(runner, batch_count);
+    uint64_t enqueue_ns = 0;
+    uint64_t dequeue_ns = 0;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        copy_queue_enqueue_n(&queue, batch, batch_count);
+        uint64_t middle = bench_get_time_ns();
+        checksum += copy_queue_dequeue_n(&queue, batch, batch_count);
+        uint64_t end = bench_get_time_ns();
+
+        enqueue_ns += middle - start;
+        dequeue_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    copy_queue_deinit(&queue);
+
+    BenchResult_t enqueue_result = {"copy_queue", "enqueue_n_u32", element_count, rounds * batch_count, enqueue_ns};
+    BenchResult_t dequeue_result = {"copy_queue", "dequeue_n_u32", element_count, rounds * batch_count, dequeue_ns};
+    bench_runner_report(runner, &enqueue_result);
+    bench_runner_report(runner, &dequeue_result);
+}
+
+typedef struct BenchMessage BenchMessage_t;
+
+struct BenchMessage
+{
+    uint32_t words[64];
+};
+
+#define BENCH_MESSAGE_COUNT (64)
+
+/**
+ * @brief Moves 256 byte messages through the queue, once built on the stack and copied in and out, and once built and
+ * read in place using reserve/commit and front/release.
+ */
+static void bench_message_copy_vs_in_place(BenchRunner_t * runner)
+{
+    static BenchMessage_t storage[BENCH_MESSAGE_COUNT];
+    CopyQueue_t queue;
+    CopyQueueConfig_t config = {
+        .queue_buffer = (uint8_t *)storage,
+        .queue_size = sizeof(storage),
+        .element_count = BENCH_MESSAGE_COUNT,
+        .element_size = sizeof(BenchMessage_t),
+    };
+
+    copy_queue_init(&queue, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, BENCH_MESSAGE_COUNT);
+    uint64_t copy_ns = 0;
+    uint64_t in_place_ns = 0;
+    BenchMessage_t message;
+    void * slot;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (uint32_t idx = 0; idx < BENCH_MESSAGE_COUNT; ++idx)
+        {
+            message.words[0] = idx;
+            message.words[63] = idx;
+            copy_queue_enqueue(&queue, &message);
+        }
+        for (size_t idx = 0; idx < BENCH_MESSAGE_COUNT; ++idx)
+        {
+            copy_queue_dequeue(&queue, &message);
+            checksum += message.words[0] + message.words[63];
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (uint32_t idx = 0; idx < BENCH_MESSAGE_COUNT; ++idx)
+        {
+            copy_queue_reserve(&queue, &slot);
+            ((BenchMessage_t *)slot)->words[0] = idx;
+            ((BenchMessage_t *)slot)->words[63] = idx;
+            copy_queue_commit(&queue);
+        }
+        for (size_t idx = 0; idx < BENCH_MESSAGE_COUNT; ++idx)
+        {
+            copy_queue_front(&queue, &slot);
+            checksum += ((BenchMessage_t *)slot)->words[0] + ((BenchMessage_t *)slot)->words[63];
+            copy_queue_release(&queue);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        copy_ns += middle - start;
+        in_place_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    copy_queue_deinit(&queue);
+
+    BenchResult_t copy_result = {"copy_queue", "round_trip_copy_256_bytes", BENCH_MESSAGE_COUNT,
+                                 rounds * BENCH_MESSAGE_COUNT, copy_ns};
+    BenchResult_t in_place_result = {"copy_queue", "round_trip_in_place_256_bytes", BENCH_MESSAGE_COUNT,
+                                     rounds * BENCH_MESSAGE_COUNT, in_place_ns};
+    bench_runner_report(runner, &copy_result);
+    bench_runner_report(runner, &in_place_result);
+}
+
+void bench_copy_queue_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_enqueue_dequeue(runner, bench_sizes[idx]);
+        bench_enqueue_dequeue_n(runner, bench_sizes[idx]);
+    }
+    bench_message_copy_vs_in_place(runner);
+}
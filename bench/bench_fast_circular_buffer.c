@@ -0,0 +1,123 @@
+#include "bench_fast_circular_buffer.h"
+
+#include <cemb/fast_circular_buffer.h>
+
+#include <string.h>
+
+#define BENCH_MAX_BUFFER_SIZE (4096)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_BUFFER_SIZE};
+
+static void bench_push_pop_byte(BenchRunner_t * runner, size_t buffer_size)
+{
+    static uint8_t storage[BENCH_MAX_BUFFER_SIZE];
+    FastCircularBuffer_t buffer;
+    FastCircularBufferConfig_t config = {
+        .buffer = storage,
+        .buffer_size = buffer_size,
+    };
+
+    fast_circular_buffer_init(&buffer, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, buffer_size);
+    uint64_t push_ns = 0;
+    uint64_t pop_ns = 0;
+    uint8_t byte = 0;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < buffer_size; ++idx)
+        {
+            fast_circular_buffer_push_byte(&buffer, (uint8_t)idx);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < buffer_size; ++idx)
+        {
+            fast_circular_buffer_pop_byte(&buffer, &byte);
+            checksum += byte;
+        }
+        uint64_t end = bench_get_time_ns();
+
+        push_ns += middle - start;
+        pop_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    fast_circular_buffer_deinit(&buffer);
+
+    BenchResult_t push_result = {"fast_circular_buffer", "push_byte", buffer_size, rounds * buffer_size, push_ns};
+    BenchResult_t pop_result = {"fast_circular_buffer", "pop_byte", buffer_size, rounds * buffer_size, pop_ns};
+    bench_runner_report(runner, &push_result);
+    bench_runner_report(runner, &pop_result);
+}
+
+/**
+ * @brief Fills and drains the buffer in place through the region API, ops are bytes so the results compare directly
+ * with the byte API.
+ */
+static void bench_write_read_region(BenchRunner_t * runner, size_t buffer_size)
+{
+    static uint8_t storage[BENCH_MAX_BUFFER_SIZE];
+    static uint8_t block[BENCH_MAX_BUFFER_SIZE];
+    FastCircularBuffer_t buffer;
+    FastCircularBufferConfig_t config = {
+        .buffer = storage,
+        .buffer_size = buffer_size,
+    };
+
+    fast_circular_buffer_init(&buffer, &config);
+
+    // blocks that do not divide the buffer size, so most transfers need two regions
+    size_t block_size = (buffer_size / 2) + 1;
+    uint64_t rounds = bench_runner_get_rounds(runner, block_size);
+    uint64_t write_ns = 0;
+    uint64_t read_ns = 0;
+    uint8_t * write_region;
+    uint8_t const * read_region;
+    size_t region_length;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        size_t remaining = block_size;
+        while ((remaining > 0) && (fast_circular_buffer_reserve_write(&buffer, &write_region, &region_length) == ERR_NONE))
+        {
+            region_length = (region_length < remaining) ? region_length : remaining;
+            memcpy(write_region, &block[block_size - remaining], region_length);
+            fast_circular_buffer_commit_write(&buffer, region_length);
+            remaining -= region_length;
+        }
+        uint64_t middle = bench_get_time_ns();
+        remaining = block_size;
+        while ((remaining > 0) && (fast_circular_buffer_acquire_read(&buffer, &read_region, &region_length) == ERR_NONE))
+        {
+            region_length = (region_length < remaining) ? region_length : remaining;
+            memcpy(&block[block_size - remaining], read_region, region_length);
+            fast_circular_buffer_release_read(&buffer, region_length);
+            remaining -= region_length;
+        }
+        uint64_t end = bench_get_time_ns();
+
+        write_ns += middle - start;
+        read_ns += end - middle;
+    }
+    bench_consume(block[0]);
+
+    fast_circular_buffer_deinit(&buffer);
+
+    BenchResult_t write_result = {"fast_circular_buffer", "write_region", buffer_size, rounds * block_size, write_ns};
+    BenchResult_t read_result = {"fast_circular_buffer", "read_region", buffer_size, rounds * block_size, read_ns};
+    bench_runner_report(runner, &write_result);
+    bench_runner_report(runner, &read_result);
+}
+
+void bench_fast_circular_buffer_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_push_pop_byte(runner, bench_sizes[idx]);
+        bench_write_read_region(runner, bench_sizes[idx]);
+    }
+}
@@ -0,0 +1,139 @@
+#include "bench_indexed_heap.h"
+
+#include <cemb/bounded_heap.h>
+#include <cemb/indexed_heap.h>
+
+#define BENCH_MAX_HEAP_SIZE (4096)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_HEAP_SIZE};
+
+typedef struct BenchTimer BenchTimer_t;
+
+struct BenchTimer
+{
+    uint32_t deadline;
+    IndexedHeapHandle_t handle;
+};
+
+static BenchTimer_t bench_timers[BENCH_MAX_HEAP_SIZE];
+
+static bool bench_timer_compare(void const * const parent, void const * const child)
+{
+    return ((BenchTimer_t const *)parent)->deadline > ((BenchTimer_t const *)child)->deadline;
+}
+
+/**
+ * @brief Cheap pseudo random sequence so the heap sees unordered keys without pulling in rand().
+ */
+static uint32_t bench_next_key(uint32_t * state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Reschedules and cancels random timers in a full heap through their handles. Ops are single reschedules, or
+ *        a cancel followed by a push of the same timer.
+ */
+static void bench_indexed(BenchRunner_t * runner, size_t heap_size)
+{
+    static IndexedHeapEntry_t heap_storage[BENCH_MAX_HEAP_SIZE];
+    static size_t position_storage[BENCH_MAX_HEAP_SIZE];
+    IndexedHeap_t heap;
+    IndexedHeapConfig_t config = {
+        .heap_storage = heap_storage,
+        .position_storage = position_storage,
+        .element_count = heap_size,
+        .compare = bench_timer_compare,
+    };
+    uint32_t key_state = 0x12345678u;
+
+    indexed_heap_init(&heap, &config);
+    for (size_t idx = 0; idx < heap_size; ++idx)
+    {
+        bench_timers[idx].deadline = bench_next_key(&key_state);
+        indexed_heap_push(&heap, &bench_timers[idx], &bench_timers[idx].handle);
+    }
+
+    uint64_t op_count = bench_runner_get_rounds(runner, 1);
+
+    uint64_t start = bench_get_time_ns();
+    for (uint64_t op = 0; op < op_count; ++op)
+    {
+        BenchTimer_t * timer = &bench_timers[bench_next_key(&key_state) % heap_size];
+        timer->deadline = bench_next_key(&key_state);
+        indexed_heap_update_key(&heap, timer->handle, timer);
+    }
+    uint64_t middle = bench_get_time_ns();
+    for (uint64_t op = 0; op < op_count; ++op)
+    {
+        BenchTimer_t * timer = &bench_timers[bench_next_key(&key_state) % heap_size];
+        indexed_heap_remove(&heap, timer->handle, NULL);
+        indexed_heap_push(&heap, timer, &timer->handle);
+    }
+    uint64_t end = bench_get_time_ns();
+
+    indexed_heap_deinit(&heap);
+
+    BenchResult_t reschedule_result = {"indexed_heap", "reschedule", heap_size, op_count, middle - start};
+    BenchResult_t cancel_result = {"indexed_heap", "cancel_push", heap_size, op_count, end - middle};
+    bench_runner_report(runner, &reschedule_result);
+    bench_runner_report(runner, &cancel_result);
+}
+
+/**
+ * @brief The same reschedule on a #BoundedHeap, which has to drain the heap and push everything back.
+ */
+static void bench_rebuild(BenchRunner_t * runner, size_t heap_size)
+{
+    static void * storage[BENCH_MAX_HEAP_SIZE];
+    static void * drained[BENCH_MAX_HEAP_SIZE];
+    BoundedHeap_t heap;
+    BoundedHeapConfig_t config = {
+        .heap_storage = storage,
+        .element_count = heap_size,
+        .compare = bench_timer_compare,
+    };
+    uint32_t key_state = 0x12345678u;
+
+    bounded_heap_init(&heap, &config);
+    for (size_t idx = 0; idx < heap_size; ++idx)
+    {
+        bench_timers[idx].deadline = bench_next_key(&key_state);
+        bounded_heap_push(&heap, &bench_timers[idx]);
+    }
+
+    // each reschedule costs a pass over the whole heap, so the count is scaled down to match the other rows' work
+    uint64_t op_count = bench_runner_get_rounds(runner, heap_size);
+
+    uint64_t start = bench_get_time_ns();
+    for (uint64_t op = 0; op < op_count; ++op)
+    {
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bounded_heap_pop(&heap, &drained[idx]);
+        }
+        bench_timers[bench_next_key(&key_state) % heap_size].deadline = bench_next_key(&key_state);
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bounded_heap_push(&heap, drained[idx]);
+        }
+    }
+    uint64_t end = bench_get_time_ns();
+
+    bounded_heap_deinit(&heap);
+
+    BenchResult_t result = {"indexed_heap", "reschedule_rebuild", heap_size, op_count, end - start};
+    bench_runner_report(runner, &result);
+}
+
+void bench_indexed_heap_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_indexed(runner, bench_sizes[idx]);
+        bench_rebuild(runner, bench_sizes[idx]);
+    }
+}
@@ -0,0 +1,95 @@
+#include "bench_instrumented_pool.h"
+
+#include <cemb/instrumented_pool.h>
+#include <cemb/static_pool.h>
+
+#define BENCH_MAX_OBJECT_COUNT (4096)
+#define BENCH_OBJECT_SIZE (32)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_OBJECT_COUNT};
+
+static uint8_t bench_buffer[BENCH_MAX_OBJECT_COUNT * BENCH_OBJECT_SIZE];
+
+static uint32_t bench_get_ticks(void)
+{
+    return (uint32_t)bench_get_time_ns();
+}
+
+/**
+ * @brief Allocates through the interface, which is either the static pool's own or the instrumented pool's.
+ */
+static void bench_allocate_deallocate(BenchRunner_t * runner, size_t object_count, bool instrumented, bool timed)
+{
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+    StaticPool_t static_pool;
+    StaticPoolConfig_t static_pool_config = {
+        .allocation_stack = NULL,
+        .buffer = bench_buffer,
+        .buffer_size = sizeof(bench_buffer),
+        .object_size = BENCH_OBJECT_SIZE,
+        .object_count = object_count,
+    };
+    IPoolAllocator_t static_pool_allocator;
+    InstrumentedPool_t pool;
+    InstrumentedPoolConfig_t config = {
+        .backing_allocator = &static_pool_allocator,
+        .get_ticks = timed ? bench_get_ticks : NULL,
+    };
+    IPoolAllocator_t interface;
+
+    static_pool_init(&static_pool, &static_pool_config);
+    static_pool_as_i_pool_allocator(&static_pool, &static_pool_allocator);
+    instrumented_pool_init(&pool, &config);
+    if (instrumented)
+    {
+        instrumented_pool_as_i_pool_allocator(&pool, &interface);
+    }
+    else
+    {
+        interface = static_pool_allocator;
+    }
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            i_pool_allocator_allocate(&interface, &objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            i_pool_allocator_deallocate(&interface, &objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    instrumented_pool_deinit(&pool);
+    static_pool_deinit(&static_pool);
+
+    char const * allocate_name = !instrumented ? "allocate_direct" : (timed ? "allocate_timed" : "allocate");
+    char const * deallocate_name = !instrumented ? "deallocate_direct" : (timed ? "deallocate_timed" : "deallocate");
+    BenchResult_t allocate_result = {"instrumented_pool", allocate_name, object_count, rounds * object_count,
+                                     allocate_ns};
+    BenchResult_t deallocate_result = {"instrumented_pool", deallocate_name, object_count, rounds * object_count,
+                                       deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+void bench_instrumented_pool_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_allocate_deallocate(runner, bench_sizes[idx], false, false);
+        bench_allocate_deallocate(runner, bench_sizes[idx], true, false);
+        bench_allocate_deallocate(runner, bench_sizes[idx], true, true);
+    }
+}
@@ -0,0 +1,96 @@
+#include "bench_le_pack.h"
+
+#include <cemb/le_pack.h>
+
+#define BENCH_PACK_BUFFER_SIZE (4096)
+
+typedef union BenchLePackElement BenchLePackElement_t;
+typedef struct BenchLePackCase BenchLePackCase_t;
+
+/**
+ * @brief Storage for one element of any packable type, each case only reads and writes its own member.
+ */
+union BenchLePackElement
+{
+    bool b;
+    uint8_t u8;
+    uint16_t u16;
+    uint32_t u32;
+    uint64_t u64;
+    int8_t s8;
+    int16_t s16;
+    int32_t s32;
+    int64_t s64;
+};
+
+/**
+ * @brief A packable type to benchmark, each case packs then unpacks a full buffer worth of elements.
+ */
+struct BenchLePackCase
+{
+    char const * pack_name;
+    char const * unpack_name;
+    size_t element_size;
+    PackSerialiseFunction_t pack;
+    PackDeserialiseFunction_t unpack;
+    BenchLePackElement_t initial; /**< Value packed each round, a valid value of the case's type. */
+};
+
+static BenchLePackCase_t const bench_cases[] = {
+    {"pack_bool", "unpack_bool", PACK_SIZE_BOOL, (PackSerialiseFunction_t)le_pack_bool, (PackDeserialiseFunction_t)le_unpack_bool, {.b = true}},
+    {"pack_u8", "unpack_u8", PACK_SIZE_UINT8_T, (PackSerialiseFunction_t)le_pack_u8, (PackDeserialiseFunction_t)le_unpack_u8, {.u8 = 0xEFu}},
+    {"pack_u16", "unpack_u16", PACK_SIZE_UINT16_T, (PackSerialiseFunction_t)le_pack_u16, (PackDeserialiseFunction_t)le_unpack_u16, {.u16 = 0xCDEFu}},
+    {"pack_u32", "unpack_u32", PACK_SIZE_UINT32_T, (PackSerialiseFunction_t)le_pack_u32, (PackDeserialiseFunction_t)le_unpack_u32, {.u32 = 0x89ABCDEFu}},
+    {"pack_u64", "unpack_u64", PACK_SIZE_UINT64_T, (PackSerialiseFunction_t)le_pack_u64, (PackDeserialiseFunction_t)le_unpack_u64, {.u64 = 0x0123456789ABCDEFu}},
+    {"pack_s8", "unpack_s8", PACK_SIZE_INT8_T, (PackSerialiseFunction_t)le_pack_s8, (PackDeserialiseFunction_t)le_unpack_s8, {.s8 = -17}},
+    {"pack_s16", "unpack_s16", PACK_SIZE_INT16_T, (PackSerialiseFunction_t)le_pack_s16, (PackDeserialiseFunction_t)le_unpack_s16, {.s16 = -12817}},
+    {"pack_s32", "unpack_s32", PACK_SIZE_INT32_T, (PackSerialiseFunction_t)le_pack_s32, (PackDeserialiseFunction_t)le_unpack_s32, {.s32 = -1985229329}},
+    {"pack_s64", "unpack_s64", PACK_SIZE_INT64_T, (PackSerialiseFunction_t)le_pack_s64, (PackDeserialiseFunction_t)le_unpack_s64, {.s64 = -81985529216486895}},
+};
+
+static void bench_pack_unpack(BenchRunner_t * runner, BenchLePackCase_t const * pack_case)
+{
+    static uint8_t buffer[BENCH_PACK_BUFFER_SIZE];
+    BenchLePackElement_t element = pack_case->initial;
+    size_t element_count = BENCH_PACK_BUFFER_SIZE / pack_case->element_size;
+
+    uint64_t rounds = bench_runner_get_rounds(runner, element_count);
+    uint64_t pack_ns = 0;
+    uint64_t unpack_ns = 0;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        size_t offset = 0;
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < element_count; ++idx)
+        {
+            offset += pack_case->pack(&element, offset, buffer, sizeof(buffer));
+        }
+        uint64_t middle = bench_get_time_ns();
+        offset = 0;
+        for (size_t idx = 0; idx < element_count; ++idx)
+        {
+            offset += pack_case->unpack(&element, offset, buffer, sizeof(buffer));
+        }
+        uint64_t end = bench_get_time_ns();
+
+        checksum += element.u8;
+        pack_ns += middle - start;
+        unpack_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    BenchResult_t pack_result = {"le_pack", pack_case->pack_name, pack_case->element_size, rounds * element_count, pack_ns};
+    BenchResult_t unpack_result = {"le_pack", pack_case->unpack_name, pack_case->element_size, rounds * element_count, unpack_ns};
+    bench_runner_report(runner, &pack_result);
+    bench_runner_report(runner, &unpack_result);
+}
+
+void bench_le_pack_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_cases) / sizeof(bench_cases[0]); ++idx)
+    {
+        bench_pack_unpack(runner, &bench_cases[idx]);
+    }
+}
@@ -0,0 +1,121 @@
+#include "bench_mpmc_copy_queue.h"
+
+#include <cemb/mpmc_copy_queue.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#define BENCH_QUEUE_ELEMENT_COUNT (1024)
+#define BENCH_MAX_THREADS_PER_SIDE (8)
+
+/**
+ * Sizes are the number of producer threads, with the same number of consumer threads.
+ */
+static size_t const bench_thread_counts[] = {1, 2, 4, BENCH_MAX_THREADS_PER_SIDE};
+
+typedef struct BenchMpmcArgs BenchMpmcArgs_t;
+
+/**
+ * @brief Per thread arguments. Threads yield whenever the queue is full or empty, so the benchmark still makes
+ * progress when there are more threads than cores.
+ */
+struct BenchMpmcArgs
+{
+    MpmcCopyQueue_t * queue;
+    uint64_t element_count;
+    uint64_t checksum;
+};
+
+static void * bench_mpmc_producer(void * context)
+{
+    BenchMpmcArgs_t * args = context;
+    for (uint64_t idx = 0; idx < args->element_count;)
+    {
+        if (mpmc_copy_queue_enqueue(args->queue, &idx) == ERR_NONE)
+        {
+            idx++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * bench_mpmc_consumer(void * context)
+{
+    BenchMpmcArgs_t * args = context;
+    uint64_t element;
+    for (uint64_t idx = 0; idx < args->element_count;)
+    {
+        if (mpmc_copy_queue_dequeue(args->queue, &element) == ERR_NONE)
+        {
+            args->checksum += element;
+            idx++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void bench_threaded(BenchRunner_t * runner, size_t threads_per_side)
+{
+    static uint64_t queue_buffer[BENCH_QUEUE_ELEMENT_COUNT];
+    static atomic_size_t sequence_buffer[BENCH_QUEUE_ELEMENT_COUNT];
+    BenchMpmcArgs_t producer_args[BENCH_MAX_THREADS_PER_SIDE];
+    BenchMpmcArgs_t consumer_args[BENCH_MAX_THREADS_PER_SIDE];
+    pthread_t producers[BENCH_MAX_THREADS_PER_SIDE];
+    pthread_t consumers[BENCH_MAX_THREADS_PER_SIDE];
+    MpmcCopyQueue_t queue;
+    MpmcCopyQueueConfig_t config = {
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+        .element_count = BENCH_QUEUE_ELEMENT_COUNT,
+        .element_size = sizeof(uint64_t),
+        .sequence_buffer = sequence_buffer,
+    };
+
+    mpmc_copy_queue_init(&queue, &config);
+
+    // the total work is fixed, so ops/sec shows how throughput scales with the thread count
+    uint64_t per_thread_count = bench_runner_get_rounds(runner, threads_per_side);
+    for (size_t idx = 0; idx < threads_per_side; ++idx)
+    {
+        producer_args[idx] = (BenchMpmcArgs_t){&queue, per_thread_count, 0};
+        consumer_args[idx] = (BenchMpmcArgs_t){&queue, per_thread_count, 0};
+    }
+
+    uint64_t start = bench_get_time_ns();
+    for (size_t idx = 0; idx < threads_per_side; ++idx)
+    {
+        pthread_create(&consumers[idx], NULL, bench_mpmc_consumer, &consumer_args[idx]);
+        pthread_create(&producers[idx], NULL, bench_mpmc_producer, &producer_args[idx]);
+    }
+    uint64_t checksum = 0;
+    for (size_t idx = 0; idx < threads_per_side; ++idx)
+    {
+        pthread_join(producers[idx], NULL);
+        pthread_join(consumers[idx], NULL);
+        checksum += consumer_args[idx].checksum;
+    }
+    uint64_t end = bench_get_time_ns();
+    bench_consume((uintptr_t)checksum);
+
+    mpmc_copy_queue_deinit(&queue);
+
+    BenchResult_t result = {"mpmc_copy_queue", "threaded_enqueue_dequeue_u64", threads_per_side,
+                            per_thread_count * threads_per_side, end - start};
+    bench_runner_report(runner, &result);
+}
+
+void bench_mpmc_copy_queue_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_thread_counts) / sizeof(bench_thread_counts[0]); ++idx)
+    {
+        bench_threaded(runner, bench_thread_counts[idx]);
+    }
+}
@@ -0,0 +1,128 @@
+#include "bench_pool_magazine.h"
+
+#include <cemb/concurrent_pool.h>
+#include <cemb/pool_magazine.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#define BENCH_OBJECT_COUNT (1024)
+#define BENCH_OBJECT_SIZE (32)
+#define BENCH_MAX_THREADS (8)
+#define BENCH_OBJECTS_HELD_PER_THREAD (4)
+#define BENCH_MAGAZINE_SIZE (32)
+#define BENCH_BATCH_SIZE (16)
+
+/**
+ * Sizes are the number of threads sharing the backing pool.
+ */
+static size_t const bench_thread_counts[] = {1, 2, 4, BENCH_MAX_THREADS};
+
+typedef struct BenchMagazineArgs BenchMagazineArgs_t;
+
+/**
+ * @brief Per thread arguments, each thread owns a magazine in front of the shared concurrent pool.
+ */
+struct BenchMagazineArgs
+{
+    IPoolAllocator_t const * backing_allocator;
+    uint64_t round_count;
+    PoolMagazineStats_t stats;
+};
+
+static void * bench_magazine_thread(void * context)
+{
+    BenchMagazineArgs_t * args = context;
+    void * object_buffer[BENCH_MAGAZINE_SIZE];
+    void * held[BENCH_OBJECTS_HELD_PER_THREAD];
+    PoolMagazine_t magazine;
+    PoolMagazineConfig_t config = {
+        .backing_allocator = args->backing_allocator,
+        .object_buffer = object_buffer,
+        .magazine_size = BENCH_MAGAZINE_SIZE,
+        .batch_size = BENCH_BATCH_SIZE,
+    };
+
+    pool_magazine_init(&magazine, &config);
+
+    for (uint64_t round = 0; round < args->round_count; ++round)
+    {
+        for (size_t idx = 0; idx < BENCH_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            while (pool_magazine_allocate(&magazine, &held[idx]) != ERR_NONE)
+            {
+                sched_yield();
+            }
+        }
+        for (size_t idx = 0; idx < BENCH_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            pool_magazine_deallocate(&magazine, &held[idx]);
+        }
+    }
+
+    pool_magazine_get_stats(&magazine, &args->stats);
+    pool_magazine_deinit(&magazine);
+    return NULL;
+}
+
+/**
+ * @brief Runs threads through their magazines, ops are allocate plus deallocate pairs so the results compare directly
+ * with the concurrent_pool rows.
+ */
+static void bench_threaded(BenchRunner_t * runner, size_t thread_count)
+{
+    static uint8_t buffer[BENCH_OBJECT_COUNT * BENCH_OBJECT_SIZE];
+    static atomic_size_t link_buffer[BENCH_OBJECT_COUNT];
+    BenchMagazineArgs_t args[BENCH_MAX_THREADS];
+    pthread_t threads[BENCH_MAX_THREADS];
+    ConcurrentPool_t pool;
+    IPoolAllocator_t pool_allocator;
+    ConcurrentPoolConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = BENCH_OBJECT_SIZE,
+        .object_count = BENCH_OBJECT_COUNT,
+        .link_buffer = link_buffer,
+    };
+
+    concurrent_pool_init(&pool, &config);
+    concurrent_pool_as_i_pool_allocator(&pool, &pool_allocator);
+
+    uint64_t round_count = bench_runner_get_rounds(runner, thread_count * BENCH_OBJECTS_HELD_PER_THREAD);
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        args[idx] = (BenchMagazineArgs_t){&pool_allocator, round_count, {0}};
+    }
+
+    uint64_t start = bench_get_time_ns();
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        pthread_create(&threads[idx], NULL, bench_magazine_thread, &args[idx]);
+    }
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        pthread_join(threads[idx], NULL);
+    }
+    uint64_t end = bench_get_time_ns();
+
+    uint64_t backing_calls = 0;
+    for (size_t idx = 0; idx < thread_count; ++idx)
+    {
+        backing_calls += args[idx].stats.refill_count + args[idx].stats.flush_count;
+    }
+    bench_consume((uintptr_t)backing_calls);
+
+    concurrent_pool_deinit(&pool);
+
+    BenchResult_t result = {"pool_magazine", "threaded_allocate_deallocate", thread_count,
+                            round_count * thread_count * BENCH_OBJECTS_HELD_PER_THREAD, end - start};
+    bench_runner_report(runner, &result);
+}
+
+void bench_pool_magazine_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_thread_counts) / sizeof(bench_thread_counts[0]); ++idx)
+    {
+        bench_threaded(runner, bench_thread_counts[idx]);
+    }
+}
@@ -0,0 +1,56 @@
+#include "bench_ptr_stack.h"
+
+#include <cemb/ptr_stack.h>
+
+#define BENCH_MAX_STACK_SIZE (4096)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_STACK_SIZE};
+
+static void bench_push_pop(BenchRunner_t * runner, size_t stack_size)
+{
+    static void * storage[BENCH_MAX_STACK_SIZE];
+    PtrStack_t stack;
+
+    ptr_stack_init(&stack, storage, stack_size);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, stack_size);
+    uint64_t push_ns = 0;
+    uint64_t pop_ns = 0;
+    void * value = NULL;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < stack_size; ++idx)
+        {
+            ptr_stack_push(&stack, (void *)(uintptr_t)idx);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < stack_size; ++idx)
+        {
+            ptr_stack_pop(&stack, &value);
+            checksum += (uintptr_t)value;
+        }
+        uint64_t end = bench_get_time_ns();
+
+        push_ns += middle - start;
+        pop_ns += end - middle;
+    }
+    bench_consume(checksum);
+
+    ptr_stack_deinit(&stack);
+
+    BenchResult_t push_result = {"ptr_stack", "push", stack_size, rounds * stack_size, push_ns};
+    BenchResult_t pop_result = {"ptr_stack", "pop", stack_size, rounds * stack_size, pop_ns};
+    bench_runner_report(runner, &push_result);
+    bench_runner_report(runner, &pop_result);
+}
+
+void bench_ptr_stack_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_push_pop(runner, bench_sizes[idx]);
+    }
+}
@@ -0,0 +1,96 @@
+#include "bench_common.h"
+#include "bench_arena.h"
+#include "bench_bitmap_pool.h"
+#include "bench_bounded_heap.h"
+#include "bench_buddy_allocator.h"
+#include "bench_circular_buffer.h"
+#include "bench_concurrent_pool.h"
+#include "bench_copy_queue.h"
+#include "bench_fast_circular_buffer.h"
+#include "bench_indexed_heap.h"
+#include "bench_instrumented_pool.h"
+#include "bench_le_pack.h"
+#include "bench_mpmc_copy_queue.h"
+#include "bench_pool_magazine.h"
+#include "bench_ptr_stack.h"
+#include "bench_simple_fsm.h"
+#include "bench_slab_allocator.h"
+#include "bench_spsc_fast_circular_buffer.h"
+#include "bench_static_pool.h"
+#include "bench_tlsf_allocator.h"
+#include "bench_top_k.h"
+#include "bench_typed_bounded_heap.h"
+#include "bench_typed_copy_queue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DEFAULT_TARGET_OPS (1u << 22)
+
+static void bench_print_usage(char const * program)
+{
+    fprintf(stderr, "usage: %s [--format=csv|json] [--ops=<operations per benchmark>]\n", program);
+}
+
+int main(int argc, char ** argv)
+{
+    BenchOutputFormat_t format = BENCH_OUTPUT_FORMAT_CSV;
+    uint64_t target_ops = BENCH_DEFAULT_TARGET_OPS;
+
+    for (int idx = 1; idx < argc; ++idx)
+    {
+        if (strcmp(argv[idx], "--format=csv") == 0)
+        {
+            format = BENCH_OUTPUT_FORMAT_CSV;
+        }
+        else if (strcmp(argv[idx], "--format=json") == 0)
+        {
+            format = BENCH_OUTPUT_FORMAT_JSON;
+        }
+        else if (strncmp(argv[idx], "--ops=", strlen("--ops=")) == 0)
+        {
+            target_ops = strtoull(argv[idx] + strlen("--ops="), NULL, 10);
+            if (target_ops == 0)
+            {
+                bench_print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else
+        {
+            bench_print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    BenchRunner_t runner;
+    bench_runner_init(&runner, format, stdout, target_ops);
+
+    bench_arena_run(&runner);
+    bench_bitmap_pool_run(&runner);
+    bench_bounded_heap_run(&runner);
+    bench_buddy_allocator_run(&runner);
+    bench_circular_buffer_run(&runner);
+    bench_concurrent_pool_run(&runner);
+    bench_copy_queue_run(&runner);
+    bench_fast_circular_buffer_run(&runner);
+    bench_indexed_heap_run(&runner);
+    bench_instrumented_pool_run(&runner);
+    bench_le_pack_run(&runner);
+    bench_mpmc_copy_queue_run(&runner);
+    bench_pool_magazine_run(&runner);
+    bench_ptr_stack_run(&runner);
+    bench_simple_fsm_run(&runner);
+    bench_slab_allocator_run(&runner);
+    bench_spsc_fast_circular_buffer_run(&runner);
+    bench_static_pool_run(&runner);
+    bench_tlsf_allocator_run(&runner);
+    bench_top_k_run(&runner);
+    bench_typed_bounded_heap_run(&runner);
+    bench_typed_copy_queue_run(&runner);
+
+    bench_runner_deinit(&runner);
+
+    return 0;
+}
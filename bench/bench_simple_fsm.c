@@ -0,0 +1,81 @@
+#include "bench_simple_fsm.h"
+
+#include <cemb/simple_fsm.h>
+
+#define BENCH_MAX_STATE_COUNT (64)
+
+static size_t const bench_sizes[] = {2, 8, BENCH_MAX_STATE_COUNT};
+
+static size_t bench_on_entry_exit(SimpleFSM_t * fsm, void * context)
+{
+    (void)context;
+    return simple_fsm_get_current_state(fsm);
+}
+
+/**
+ * @brief Every event moves to the next state (wrapping), so each event costs a full exit/entry transition.
+ */
+static size_t bench_on_event_transition(SimpleFSM_t * fsm, void const * event, void * context)
+{
+    (void)event;
+    size_t state_count = *(size_t const *)context;
+    return (simple_fsm_get_current_state(fsm) + 1) % state_count;
+}
+
+/**
+ * @brief Every event keeps the current state, measuring the dispatch overhead only.
+ */
+static size_t bench_on_event_stay(SimpleFSM_t * fsm, void const * event, void * context)
+{
+    (void)event;
+    (void)context;
+    return simple_fsm_get_current_state(fsm);
+}
+
+static void bench_on_event(BenchRunner_t * runner, size_t state_count, SimpleFSMOnEventFunction_t on_event,
+                           char const * name)
+{
+    static SimpleFSMStateDelegates_t delegates[BENCH_MAX_STATE_COUNT];
+    SimpleFSM_t fsm;
+
+    for (size_t idx = 0; idx < state_count; ++idx)
+    {
+        delegates[idx].on_entry_handler = bench_on_entry_exit;
+        delegates[idx].on_event_handler = on_event;
+        delegates[idx].on_exit_handler = bench_on_entry_exit;
+    }
+
+    SimpleFSMConfig_t config = {
+        .context = &state_count,
+        .state_delegates = delegates,
+        .state_count = state_count,
+        .initial_state = 0,
+        .max_transition_count = 1,
+    };
+
+    simple_fsm_init(&fsm, &config);
+    simple_fsm_start(&fsm);
+
+    uint64_t ops = bench_runner_get_rounds(runner, 1);
+    uint64_t start = bench_get_time_ns();
+    for (uint64_t idx = 0; idx < ops; ++idx)
+    {
+        simple_fsm_on_event(&fsm, NULL);
+    }
+    uint64_t end = bench_get_time_ns();
+    bench_consume(simple_fsm_get_current_state(&fsm));
+
+    simple_fsm_deinit(&fsm);
+
+    BenchResult_t result = {"simple_fsm", name, state_count, ops, end - start};
+    bench_runner_report(runner, &result);
+}
+
+void bench_simple_fsm_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_on_event(runner, bench_sizes[idx], bench_on_event_stay, "on_event_stay");
+        bench_on_event(runner, bench_sizes[idx], bench_on_event_transition, "on_event_transition");
+    }
+}
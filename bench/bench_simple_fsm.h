@@ -0,0 +1,5 @@
+#pragma once
+
+#include "bench_common.h"
+
+void bench_simple_fsm_run(BenchRunner_t * runner);
@@ -0,0 +1,91 @@
+#include "bench_slab_allocator.h"
+
+#include <cemb/slab_allocator.h>
+
+#define BENCH_SIZE_CLASS_COUNT (8)
+#define BENCH_OBJECTS_PER_CLASS (256)
+#define BENCH_MAX_OBJECT_SIZE (1024)
+#define BENCH_REQUEST_COUNT (256)
+
+/**
+ * @brief Size classes doubling from 8 to 1024 bytes.
+ */
+static size_t const bench_class_sizes[BENCH_SIZE_CLASS_COUNT] = {8, 16, 32, 64, 128, 256, 512, 1024};
+
+/**
+ * @brief Allocates then frees a batch of objects with sizes spread over every class, ops are single allocations or
+ * deallocations.
+ */
+static void bench_allocate_deallocate_mixed(BenchRunner_t * runner)
+{
+    static uint8_t buffer[BENCH_OBJECTS_PER_CLASS * 2048];
+    static void * allocation_stacks[BENCH_SIZE_CLASS_COUNT][BENCH_OBJECTS_PER_CLASS];
+    static uint8_t lookup_table[SLAB_ALLOCATOR_LOOKUP_TABLE_SIZE(BENCH_MAX_OBJECT_SIZE)];
+    static void * objects[BENCH_REQUEST_COUNT];
+    static size_t request_sizes[BENCH_REQUEST_COUNT];
+    SlabSizeClassConfig_t size_classes[BENCH_SIZE_CLASS_COUNT];
+    StaticPool_t pools[BENCH_SIZE_CLASS_COUNT];
+    SlabAllocator_t slab;
+
+    for (size_t idx = 0; idx < BENCH_SIZE_CLASS_COUNT; ++idx)
+    {
+        size_classes[idx] = (SlabSizeClassConfig_t){bench_class_sizes[idx], BENCH_OBJECTS_PER_CLASS,
+                                                    allocation_stacks[idx]};
+    }
+
+    // a fixed pseudo random spread of sizes, so every run makes the same requests
+    uint32_t seed = 1;
+    for (size_t idx = 0; idx < BENCH_REQUEST_COUNT; ++idx)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        request_sizes[idx] = (seed >> 8) % (BENCH_MAX_OBJECT_SIZE + 1);
+    }
+
+    SlabAllocatorConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .size_classes = size_classes,
+        .pools = pools,
+        .size_class_count = BENCH_SIZE_CLASS_COUNT,
+        .lookup_table = lookup_table,
+        .lookup_table_size = sizeof(lookup_table),
+    };
+
+    slab_allocator_init(&slab, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, BENCH_REQUEST_COUNT);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < BENCH_REQUEST_COUNT; ++idx)
+        {
+            slab_allocator_allocate_sized(&slab, request_sizes[idx], &objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < BENCH_REQUEST_COUNT; ++idx)
+        {
+            slab_allocator_deallocate(&slab, &objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    slab_allocator_deinit(&slab);
+
+    BenchResult_t allocate_result = {"slab_allocator", "allocate_sized_mixed", BENCH_SIZE_CLASS_COUNT,
+                                     rounds * BENCH_REQUEST_COUNT, allocate_ns};
+    BenchResult_t deallocate_result = {"slab_allocator", "deallocate_mixed", BENCH_SIZE_CLASS_COUNT,
+                                       rounds * BENCH_REQUEST_COUNT, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+void bench_slab_allocator_run(BenchRunner_t * runner)
+{
+    bench_allocate_deallocate_mixed(runner);
+}
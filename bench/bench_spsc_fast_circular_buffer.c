@@ -0,0 +1,190 @@
+#include "bench_spsc_fast_circular_buffer.h"
+
+#include <cemb/fast_circular_buffer.h>
+#include <cemb/spsc_fast_circular_buffer.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#define BENCH_MAX_BUFFER_SIZE (4096)
+#define BENCH_BLOCK_SIZE (64)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_BUFFER_SIZE};
+
+typedef struct BenchSpscArgs BenchSpscArgs_t;
+
+/**
+ * Threads yield whenever the buffer is full or empty, so the benchmark still makes progress on a single core.
+ */
+
+/**
+ * @brief Shared between the producer and consumer threads of a single run.
+ */
+struct BenchSpscArgs
+{
+    SpscFastCircularBuffer_t * spsc;
+    FastCircularBuffer_t * locked;
+    pthread_mutex_t * lock;
+    uint64_t byte_count;
+    uintptr_t checksum;
+};
+
+static void * bench_spsc_producer(void * context)
+{
+    BenchSpscArgs_t * args = context;
+    for (uint64_t idx = 0; idx < args->byte_count;)
+    {
+        if (spsc_fast_circular_buffer_push_byte(args->spsc, (uint8_t)idx) == ERR_NONE)
+        {
+            idx++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * bench_spsc_consumer(void * context)
+{
+    BenchSpscArgs_t * args = context;
+    uint8_t byte;
+    for (uint64_t idx = 0; idx < args->byte_count;)
+    {
+        if (spsc_fast_circular_buffer_pop_byte(args->spsc, &byte) == ERR_NONE)
+        {
+            args->checksum += byte;
+            idx++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * bench_spsc_block_producer(void * context)
+{
+    BenchSpscArgs_t * args = context;
+    uint8_t block[BENCH_BLOCK_SIZE] = {0};
+    for (uint64_t idx = 0; idx < args->byte_count;)
+    {
+        uint64_t remaining = args->byte_count - idx;
+        size_t count = spsc_fast_circular_buffer_push(args->spsc, block, (remaining < sizeof(block)) ? (size_t)remaining : sizeof(block));
+        if (count == 0) sched_yield();
+        idx += count;
+    }
+    return NULL;
+}
+
+static void * bench_spsc_block_consumer(void * context)
+{
+    BenchSpscArgs_t * args = context;
+    uint8_t block[BENCH_BLOCK_SIZE];
+    for (uint64_t idx = 0; idx < args->byte_count;)
+    {
+        size_t count = spsc_fast_circular_buffer_pop(args->spsc, block, sizeof(block));
+        if (count == 0) sched_yield();
+        idx += count;
+    }
+    args->checksum += block[0];
+    return NULL;
+}
+
+/**
+ * @brief The baseline this variant replaces, every call on the single threaded buffer is wrapped in a mutex.
+ *
+ * The locked buffer overrides the oldest byte when full, so the producer waits for space to keep the comparison fair.
+ */
+static void * bench_locked_producer(void * context)
+{
+    BenchSpscArgs_t * args = context;
+    size_t capacity = args->locked->size_mask + 1;
+    for (uint64_t idx = 0; idx < args->byte_count;)
+    {
+        pthread_mutex_lock(args->lock);
+        bool has_space = fast_circular_buffer_get_count(args->locked) < capacity;
+        if (has_space)
+        {
+            fast_circular_buffer_push_byte(args->locked, (uint8_t)idx);
+            idx++;
+        }
+        pthread_mutex_unlock(args->lock);
+        if (!has_space) sched_yield();
+    }
+    return NULL;
+}
+
+static void * bench_locked_consumer(void * context)
+{
+    BenchSpscArgs_t * args = context;
+    uint8_t byte;
+    for (uint64_t idx = 0; idx < args->byte_count;)
+    {
+        pthread_mutex_lock(args->lock);
+        bool has_byte = (fast_circular_buffer_pop_byte(args->locked, &byte) == ERR_NONE);
+        pthread_mutex_unlock(args->lock);
+        if (has_byte)
+        {
+            args->checksum += byte;
+            idx++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void bench_threaded(BenchRunner_t * runner, size_t buffer_size, char const * name,
+                           void * (*producer)(void *), void * (*consumer)(void *))
+{
+    static uint8_t storage[BENCH_MAX_BUFFER_SIZE];
+    SpscFastCircularBuffer_t spsc;
+    FastCircularBuffer_t locked;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    FastCircularBufferConfig_t config = {
+        .buffer = storage,
+        .buffer_size = buffer_size,
+    };
+
+    spsc_fast_circular_buffer_init(&spsc, &config);
+    fast_circular_buffer_init(&locked, &config);
+
+    BenchSpscArgs_t args = {
+        .spsc = &spsc,
+        .locked = &locked,
+        .lock = &lock,
+        .byte_count = bench_runner_get_rounds(runner, 1),
+        .checksum = 0,
+    };
+    pthread_t producer_thread;
+    pthread_t consumer_thread;
+
+    uint64_t start = bench_get_time_ns();
+    pthread_create(&consumer_thread, NULL, consumer, &args);
+    pthread_create(&producer_thread, NULL, producer, &args);
+    pthread_join(producer_thread, NULL);
+    pthread_join(consumer_thread, NULL);
+    uint64_t end = bench_get_time_ns();
+    bench_consume(args.checksum);
+
+    spsc_fast_circular_buffer_deinit(&spsc);
+    fast_circular_buffer_deinit(&locked);
+
+    BenchResult_t result = {"spsc_fast_circular_buffer", name, buffer_size, args.byte_count, end - start};
+    bench_runner_report(runner, &result);
+}
+
+void bench_spsc_fast_circular_buffer_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_threaded(runner, bench_sizes[idx], "threaded_byte", bench_spsc_producer, bench_spsc_consumer);
+        bench_threaded(runner, bench_sizes[idx], "threaded_block", bench_spsc_block_producer, bench_spsc_block_consumer);
+        bench_threaded(runner, bench_sizes[idx], "mutex_baseline_byte", bench_locked_producer, bench_locked_consumer);
+    }
+}
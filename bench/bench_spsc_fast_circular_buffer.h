@@ -0,0 +1,5 @@
+#pragma once
+
+#include "bench_common.h"
+
+void bench_spsc_fast_circular_buffer_run(BenchRunner_t * runner);
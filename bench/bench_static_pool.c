@@ -0,0 +1,249 @@
+#include "bench_static_pool.h"
+
+#include <cemb/static_pool.h>
+
+#include <pthread.h>
+
+#define BENCH_MAX_OBJECT_COUNT (4096)
+#define BENCH_OBJECT_SIZE (32)
+#define BENCH_BATCH_SIZE (16)
+#define BENCH_SHARING_THREAD_COUNT (2)
+#define BENCH_SHARING_OBJECT_SIZE (sizeof(uint64_t))
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_OBJECT_COUNT};
+
+static uint8_t bench_buffer[BENCH_MAX_OBJECT_COUNT * BENCH_OBJECT_SIZE];
+static void * bench_allocation_stack[BENCH_MAX_OBJECT_COUNT];
+
+/**
+ * @brief Gets a pool config, intrusive pools have no allocation stack.
+ */
+static StaticPoolConfig_t bench_get_config(size_t object_count, bool intrusive)
+{
+    StaticPoolConfig_t config = {
+        .allocation_stack = intrusive ? NULL : bench_allocation_stack,
+        .buffer = bench_buffer,
+        .buffer_size = sizeof(bench_buffer),
+        .object_size = BENCH_OBJECT_SIZE,
+        .object_count = object_count,
+    };
+    return config;
+}
+
+static void bench_allocate_deallocate(BenchRunner_t * runner, size_t object_count, bool intrusive)
+{
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+    StaticPool_t pool;
+    StaticPoolConfig_t config = bench_get_config(object_count, intrusive);
+
+    static_pool_init(&pool, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            static_pool_allocate(&pool, &objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            static_pool_deallocate(&pool, &objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    static_pool_deinit(&pool);
+
+    BenchResult_t allocate_result = {"static_pool", intrusive ? "allocate_intrusive" : "allocate", object_count,
+                                     rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"static_pool", intrusive ? "deallocate_intrusive" : "deallocate", object_count,
+                                       rounds * object_count, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+/**
+ * @brief Allocates and frees batches through the pool interface, one call per object or one call per batch.
+ */
+static void bench_interface_batches(BenchRunner_t * runner, size_t object_count, bool bulk)
+{
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+    StaticPool_t pool;
+    StaticPoolConfig_t config = bench_get_config(object_count, false);
+    IPoolAllocator_t interface;
+
+    static_pool_init(&pool, &config);
+    static_pool_as_i_pool_allocator(&pool, &interface);
+
+    size_t batch_size = (object_count < BENCH_BATCH_SIZE) ? object_count : BENCH_BATCH_SIZE;
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t batch = 0; batch < object_count; batch += batch_size)
+        {
+            if (bulk)
+            {
+                i_pool_allocator_allocate_bulk(&interface, &objects[batch], batch_size);
+                continue;
+            }
+            for (size_t idx = batch; idx < (batch + batch_size); ++idx)
+            {
+                i_pool_allocator_allocate(&interface, &objects[idx]);
+            }
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t batch = 0; batch < object_count; batch += batch_size)
+        {
+            if (bulk)
+            {
+                i_pool_allocator_deallocate_bulk(&interface, &objects[batch], batch_size);
+                continue;
+            }
+            for (size_t idx = batch; idx < (batch + batch_size); ++idx)
+            {
+                i_pool_allocator_deallocate(&interface, &objects[idx]);
+            }
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    static_pool_deinit(&pool);
+
+    BenchResult_t allocate_result = {"static_pool", bulk ? "interface_allocate_bulk" : "interface_allocate",
+                                     object_count, rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"static_pool", bulk ? "interface_deallocate_bulk" : "interface_deallocate",
+                                       object_count, rounds * object_count, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+/**
+ * @brief Per thread arguments for the false sharing bench, each thread only ever touches its own object.
+ */
+typedef struct BenchSharingArgs BenchSharingArgs_t;
+
+struct BenchSharingArgs
+{
+    uint64_t volatile * counter;
+    uint64_t increment_count;
+};
+
+static void * bench_sharing_thread(void * context)
+{
+    BenchSharingArgs_t * args = context;
+
+    for (uint64_t idx = 0; idx < args->increment_count; ++idx)
+    {
+        *args->counter += 1;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Threads increment counters in neighbouring pool objects, packed objects share a cache line, aligned ones do
+ *        not. Ops are increments.
+ */
+static void bench_false_sharing(BenchRunner_t * runner, bool aligned)
+{
+    static _Alignas(CEMB_CACHE_LINE_SIZE) uint8_t buffer[STATIC_POOL_CACHE_LINE_BUFFER_SIZE(
+        BENCH_SHARING_OBJECT_SIZE, BENCH_SHARING_THREAD_COUNT)];
+    BenchSharingArgs_t args[BENCH_SHARING_THREAD_COUNT];
+    pthread_t threads[BENCH_SHARING_THREAD_COUNT];
+    void * objects[BENCH_SHARING_THREAD_COUNT];
+    StaticPool_t pool;
+    StaticPoolConfig_t config = {
+        .allocation_stack = NULL,
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = BENCH_SHARING_OBJECT_SIZE,
+        .object_count = BENCH_SHARING_THREAD_COUNT,
+        .alignment = aligned ? CEMB_CACHE_LINE_SIZE : 0,
+    };
+
+    static_pool_init(&pool, &config);
+
+    uint64_t increment_count = bench_runner_get_rounds(runner, BENCH_SHARING_THREAD_COUNT);
+    for (size_t idx = 0; idx < BENCH_SHARING_THREAD_COUNT; ++idx)
+    {
+        static_pool_allocate(&pool, &objects[idx]);
+        args[idx] = (BenchSharingArgs_t){objects[idx], increment_count};
+        *args[idx].counter = 0;
+    }
+
+    uint64_t start = bench_get_time_ns();
+    for (size_t idx = 0; idx < BENCH_SHARING_THREAD_COUNT; ++idx)
+    {
+        pthread_create(&threads[idx], NULL, bench_sharing_thread, &args[idx]);
+    }
+    for (size_t idx = 0; idx < BENCH_SHARING_THREAD_COUNT; ++idx)
+    {
+        pthread_join(threads[idx], NULL);
+    }
+    uint64_t end = bench_get_time_ns();
+
+    for (size_t idx = 0; idx < BENCH_SHARING_THREAD_COUNT; ++idx)
+    {
+        bench_consume(*args[idx].counter);
+        static_pool_deallocate(&pool, &objects[idx]);
+    }
+    static_pool_deinit(&pool);
+
+    BenchResult_t result = {"static_pool", aligned ? "false_sharing_aligned" : "false_sharing_packed",
+                            BENCH_SHARING_THREAD_COUNT, increment_count * BENCH_SHARING_THREAD_COUNT, end - start};
+    bench_runner_report(runner, &result);
+}
+
+/**
+ * @brief Times pool initialisation, ops are init calls so the cost per call is reported.
+ */
+static void bench_init(BenchRunner_t * runner, size_t object_count, bool intrusive)
+{
+    StaticPool_t pool;
+    StaticPoolConfig_t config = bench_get_config(object_count, intrusive);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t init_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        static_pool_init(&pool, &config);
+        uint64_t end = bench_get_time_ns();
+        init_ns += end - start;
+        bench_consume(static_pool_get_available_count(&pool));
+        static_pool_deinit(&pool);
+    }
+
+    BenchResult_t init_result = {"static_pool", intrusive ? "init_intrusive" : "init", object_count, rounds, init_ns};
+    bench_runner_report(runner, &init_result);
+}
+
+void bench_static_pool_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_allocate_deallocate(runner, bench_sizes[idx], false);
+        bench_allocate_deallocate(runner, bench_sizes[idx], true);
+        bench_interface_batches(runner, bench_sizes[idx], false);
+        bench_interface_batches(runner, bench_sizes[idx], true);
+        bench_init(runner, bench_sizes[idx], false);
+        bench_init(runner, bench_sizes[idx], true);
+    }
+    bench_false_sharing(runner, false);
+    bench_false_sharing(runner, true);
+}
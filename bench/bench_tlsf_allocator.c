@@ -0,0 +1,110 @@
+#include "bench_tlsf_allocator.h"
+
+#include <cemb/tlsf_allocator.h>
+
+#include <stdlib.h>
+
+#define BENCH_MAX_OBJECT_COUNT (1024)
+#define BENCH_MAX_OBJECT_SIZE (256)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_OBJECT_COUNT};
+
+/**
+ * @brief Request sizes cycle through small and medium lengths, like variable length messages.
+ */
+static inline size_t bench_get_request_size(size_t idx)
+{
+    return ((idx * 37) % BENCH_MAX_OBJECT_SIZE) + 1;
+}
+
+static void bench_allocate_deallocate(BenchRunner_t * runner, size_t object_count)
+{
+    static _Alignas(TLSF_ALLOCATOR_ALIGN_SIZE) uint8_t buffer[BENCH_MAX_OBJECT_COUNT * (BENCH_MAX_OBJECT_SIZE + 64)];
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+    TlsfAllocator_t tlsf;
+    TlsfAllocatorConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+    };
+
+    tlsf_allocator_init(&tlsf, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            tlsf_allocator_allocate(&tlsf, bench_get_request_size(idx + round), &objects[idx]);
+        }
+        uint64_t middle = bench_get_time_ns();
+        // free every other object first so the second pass merges on both sides
+        for (size_t idx = 0; idx < object_count; idx += 2)
+        {
+            tlsf_allocator_deallocate(&tlsf, &objects[idx]);
+        }
+        for (size_t idx = 1; idx < object_count; idx += 2)
+        {
+            tlsf_allocator_deallocate(&tlsf, &objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    tlsf_allocator_deinit(&tlsf);
+
+    BenchResult_t allocate_result = {"tlsf_allocator", "allocate", object_count, rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"tlsf_allocator", "deallocate", object_count, rounds * object_count, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+static void bench_malloc_free(BenchRunner_t * runner, size_t object_count)
+{
+    static void * objects[BENCH_MAX_OBJECT_COUNT];
+
+    uint64_t rounds = bench_runner_get_rounds(runner, object_count);
+    uint64_t allocate_ns = 0;
+    uint64_t deallocate_ns = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; ++idx)
+        {
+            objects[idx] = malloc(bench_get_request_size(idx + round));
+        }
+        uint64_t middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < object_count; idx += 2)
+        {
+            free(objects[idx]);
+        }
+        for (size_t idx = 1; idx < object_count; idx += 2)
+        {
+            free(objects[idx]);
+        }
+        uint64_t end = bench_get_time_ns();
+
+        allocate_ns += middle - start;
+        deallocate_ns += end - middle;
+    }
+
+    BenchResult_t allocate_result = {"tlsf_allocator", "malloc", object_count, rounds * object_count, allocate_ns};
+    BenchResult_t deallocate_result = {"tlsf_allocator", "free", object_count, rounds * object_count, deallocate_ns};
+    bench_runner_report(runner, &allocate_result);
+    bench_runner_report(runner, &deallocate_result);
+}
+
+void bench_tlsf_allocator_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_allocate_deallocate(runner, bench_sizes[idx]);
+        bench_malloc_free(runner, bench_sizes[idx]);
+    }
+}
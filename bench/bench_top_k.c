@@ -0,0 +1,89 @@
+#include "bench_top_k.h"
+
+#include <cemb/top_k.h>
+
+#define BENCH_MAX_K (1024)
+#define BENCH_STREAM_LENGTH (65536)
+
+/**
+ * Sizes are the number of items kept.
+ */
+static size_t const bench_sizes[] = {16, 100, BENCH_MAX_K};
+
+static uintptr_t bench_stream[BENCH_STREAM_LENGTH];
+
+/**
+ * @brief Ranks keys stored directly in the pointers.
+ */
+static bool bench_ranks_above(void const * const first, void const * const second)
+{
+    return (uintptr_t)first > (uintptr_t)second;
+}
+
+/**
+ * @brief Cheap pseudo random sequence so the selector sees unordered keys without pulling in rand().
+ */
+static uint32_t bench_next_key(uint32_t * state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Offers a stream to the selector and emits the result. A random stream is mostly rejected against the root, an
+ *        ascending one replaces the root every time. Ops are items offered.
+ */
+static void bench_offer(BenchRunner_t * runner, size_t k, bool ascending)
+{
+    static void * storage[BENCH_MAX_K];
+    static void * emitted[BENCH_MAX_K];
+    TopK_t top_k;
+    TopKConfig_t config = {
+        .heap_storage = storage,
+        .k = k,
+        .ranks_above = bench_ranks_above,
+    };
+    uint32_t key_state = 0x12345678u;
+
+    for (size_t idx = 0; idx < BENCH_STREAM_LENGTH; ++idx)
+    {
+        bench_stream[idx] = ascending ? idx : bench_next_key(&key_state);
+    }
+
+    top_k_init(&top_k, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, BENCH_STREAM_LENGTH);
+    uint64_t offer_ns = 0;
+    size_t count = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < BENCH_STREAM_LENGTH; ++idx)
+        {
+            top_k_offer(&top_k, (void *)bench_stream[idx], NULL);
+        }
+        top_k_emit_sorted(&top_k, emitted, &count);
+        uint64_t end = bench_get_time_ns();
+
+        offer_ns += end - start;
+        bench_consume((uintptr_t)emitted[0]);
+    }
+
+    top_k_deinit(&top_k);
+
+    BenchResult_t result = {"top_k", ascending ? "offer_ascending" : "offer_random", k, rounds * BENCH_STREAM_LENGTH,
+                            offer_ns};
+    bench_runner_report(runner, &result);
+}
+
+void bench_top_k_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_offer(runner, bench_sizes[idx], false);
+        bench_offer(runner, bench_sizes[idx], true);
+    }
+}
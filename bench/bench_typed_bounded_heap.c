@@ -0,0 +1,129 @@
+#include "bench_typed_bounded_heap.h"
+
+#include <cemb/bounded_heap.h>
+#include <cemb/typed_bounded_heap.h>
+
+#define BENCH_MAX_HEAP_SIZE (4096)
+
+static size_t const bench_sizes[] = {16, 256, BENCH_MAX_HEAP_SIZE};
+
+typedef struct BenchRecord BenchRecord_t;
+
+/**
+ * @brief An entry as the generic heap sees it, the heap holds a pointer and the key lives in the record.
+ */
+struct BenchRecord
+{
+    uint32_t key;
+    uint32_t id;
+};
+
+CEMB_DEFINE_BOUNDED_HEAP(BenchTypedHeap, bench_typed_heap, uint32_t, BenchRecord_t *, BENCH_MAX_HEAP_SIZE, (a) < (b))
+
+static BenchRecord_t bench_records[BENCH_MAX_HEAP_SIZE];
+
+static bool bench_record_min_compare(void const * const parent, void const * const child)
+{
+    return ((BenchRecord_t const *)parent)->key > ((BenchRecord_t const *)child)->key;
+}
+
+/**
+ * @brief Cheap pseudo random sequence so the heap sees unordered keys without pulling in rand().
+ */
+static uint32_t bench_next_key(uint32_t * state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Pushes then pops heap_size records through both heaps with the same keys, so the rows compare directly.
+ */
+static void bench_push_pop(BenchRunner_t * runner, size_t heap_size)
+{
+    static BenchTypedHeap_t typed;
+    static void * storage[BENCH_MAX_HEAP_SIZE];
+    BoundedHeap_t generic;
+    BoundedHeapConfig_t config = {
+        .heap_storage = storage,
+        .element_count = heap_size,
+        .compare = bench_record_min_compare,
+    };
+
+    bench_typed_heap_init(&typed);
+    bounded_heap_init(&generic, &config);
+
+    uint64_t rounds = bench_runner_get_rounds(runner, heap_size);
+    uint64_t typed_push_ns = 0;
+    uint64_t typed_pop_ns = 0;
+    uint64_t generic_push_ns = 0;
+    uint64_t generic_pop_ns = 0;
+    uint32_t key_state = 0x12345678u;
+    uint32_t key = 0;
+    BenchRecord_t * record = NULL;
+    void * item = NULL;
+    uintptr_t checksum = 0;
+
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bench_records[idx].key = bench_next_key(&key_state);
+            bench_records[idx].id = (uint32_t)idx;
+        }
+
+        uint64_t start = bench_get_time_ns();
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bench_typed_heap_push(&typed, bench_records[idx].key, &bench_records[idx]);
+        }
+        uint64_t typed_middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bench_typed_heap_pop(&typed, &key, &record);
+            checksum += record->id;
+        }
+        uint64_t typed_end = bench_get_time_ns();
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bounded_heap_push(&generic, &bench_records[idx]);
+        }
+        uint64_t generic_middle = bench_get_time_ns();
+        for (size_t idx = 0; idx < heap_size; ++idx)
+        {
+            bounded_heap_pop(&generic, &item);
+            checksum += ((BenchRecord_t *)item)->id;
+        }
+        uint64_t generic_end = bench_get_time_ns();
+
+        typed_push_ns += typed_middle - start;
+        typed_pop_ns += typed_end - typed_middle;
+        generic_push_ns += generic_middle - typed_end;
+        generic_pop_ns += generic_end - generic_middle;
+    }
+    bench_consume(checksum);
+
+    bench_typed_heap_deinit(&typed);
+    bounded_heap_deinit(&generic);
+
+    BenchResult_t results[] = {
+        {"typed_bounded_heap", "typed_push", heap_size, rounds * heap_size, typed_push_ns},
+        {"typed_bounded_heap", "typed_pop", heap_size, rounds * heap_size, typed_pop_ns},
+        {"typed_bounded_heap", "generic_push", heap_size, rounds * heap_size, generic_push_ns},
+        {"typed_bounded_heap", "generic_pop", heap_size, rounds * heap_size, generic_pop_ns},
+    };
+    for (size_t idx = 0; idx < sizeof(results) / sizeof(results[0]); ++idx)
+    {
+        bench_runner_report(runner, &results[idx]);
+    }
+}
+
+void bench_typed_bounded_heap_run(BenchRunner_t * runner)
+{
+    for (size_t idx = 0; idx < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++idx)
+    {
+        bench_push_pop(runner, bench_sizes[idx]);
+    }
+}
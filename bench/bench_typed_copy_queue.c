@@ -0,0 +1,90 @@
+#include "bench_typed_copy_queue.h"
+
+#include <cemb/copy_queue.h>
+#include <cemb/typed_copy_queue.h>
+
+#define BENCH_ELEMENT_COUNT (256)
+
+typedef struct BenchRecord BenchRecord_t;
+
+struct BenchRecord
+{
+    uint32_t words[8];
+};
+
+CEMB_DEFINE_COPY_QUEUE(BenchU32Queue, bench_u32_queue, uint32_t, BENCH_ELEMENT_COUNT)
+CEMB_DEFINE_COPY_QUEUE(BenchRecordQueue, bench_record_queue, BenchRecord_t, BENCH_ELEMENT_COUNT)
+
+/**
+ * @brief Generates a benchmark that moves the same elements through the typed queue and the generic #CopyQueue, so
+ * the two rows can be compared directly.
+ */
+#define BENCH_DEFINE_TYPED_VS_GENERIC(struct_name, function_prefix, element_type, label)                                \
+    static void function_prefix##_round_trip(BenchRunner_t * runner)                                                    \
+    {                                                                                                                   \
+        static struct_name##_t typed;                                                                                   \
+        static element_type storage[BENCH_ELEMENT_COUNT];                                                               \
+        CopyQueue_t generic;                                                                                            \
+        CopyQueueConfig_t config = {                                                                                    \
+            .queue_buffer = (uint8_t *)storage,                                                                         \
+            .queue_size = sizeof(storage),                                                                              \
+            .element_count = BENCH_ELEMENT_COUNT,                                                                       \
+            .element_size = sizeof(element_type),                                                                       \
+        };                                                                                                              \
+        element_type element = {0};                                                                                     \
+        uint64_t rounds = bench_runner_get_rounds(runner, BENCH_ELEMENT_COUNT);                                         \
+        uint64_t typed_ns = 0;                                                                                          \
+        uint64_t generic_ns = 0;                                                                                        \
+        uintptr_t checksum = 0;                                                                                         \
+                                                                                                                        \
+        function_prefix##_init(&typed);                                                                                 \
+        copy_queue_init(&generic, &config);                                                                             \
+                                                                                                                        \
+        for (uint64_t round = 0; round < rounds; ++round)                                                               \
+        {                                                                                                               \
+            uint64_t start = bench_get_time_ns();                                                                       \
+            for (size_t idx = 0; idx < BENCH_ELEMENT_COUNT; ++idx)                                                      \
+            {                                                                                                           \
+                function_prefix##_enqueue(&typed, &element);                                                            \
+            }                                                                                                           \
+            for (size_t idx = 0; idx < BENCH_ELEMENT_COUNT; ++idx)                                                      \
+            {                                                                                                           \
+                function_prefix##_dequeue(&typed, &element);                                                            \
+                checksum += *(uint32_t *)&element;                                                                      \
+            }                                                                                                           \
+            uint64_t middle = bench_get_time_ns();                                                                      \
+            for (size_t idx = 0; idx < BENCH_ELEMENT_COUNT; ++idx)                                                      \
+            {                                                                                                           \
+                copy_queue_enqueue(&generic, &element);                                                                 \
+            }                                                                                                           \
+            for (size_t idx = 0; idx < BENCH_ELEMENT_COUNT; ++idx)                                                      \
+            {                                                                                                           \
+                copy_queue_dequeue(&generic, &element);                                                                 \
+                checksum += *(uint32_t *)&element;                                                                      \
+            }                                                                                                           \
+            uint64_t end = bench_get_time_ns();                                                                         \
+                                                                                                                        \
+            typed_ns += middle - start;                                                                                 \
+            generic_ns += end - middle;                                                                                 \
+        }                                                                                                               \
+        bench_consume(checksum);                                                                                        \
+                                                                                                                        \
+        function_prefix##_deinit(&typed);                                                                               \
+        copy_queue_deinit(&generic);                                                                                    \
+                                                                                                                        \
+        BenchResult_t typed_result = {"typed_copy_queue", "typed_" label, BENCH_ELEMENT_COUNT,                          \
+                                      rounds * BENCH_ELEMENT_COUNT, typed_ns};                                          \
+        BenchResult_t generic_result = {"typed_copy_queue", "generic_" label, BENCH_ELEMENT_COUNT,                      \
+                                        rounds * BENCH_ELEMENT_COUNT, generic_ns};                                      \
+        bench_runner_report(runner, &typed_result);                                                                     \
+        bench_runner_report(runner, &generic_result);                                                                   \
+    }
+
+BENCH_DEFINE_TYPED_VS_GENERIC(BenchU32Queue, bench_u32_queue, uint32_t, "round_trip_u32")
+BENCH_DEFINE_TYPED_VS_GENERIC(BenchRecordQueue, bench_record_queue, BenchRecord_t, "round_trip_32_bytes")
+
+void bench_typed_copy_queue_run(BenchRunner_t * runner)
+{
+    bench_u32_queue_round_trip(runner);
+    bench_record_queue_round_trip(runner);
+}
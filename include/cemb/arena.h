@@ -0,0 +1,163 @@
+/**
+ * @file
+ * @brief A bump allocator over a static buffer, for scratch memory that is all released together.
+ *
+ * Does not take into account threaded operations, as this arena does not lock.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+
+typedef struct Arena Arena_t;
+typedef struct ArenaConfig ArenaConfig_t;
+typedef struct ArenaBlock ArenaBlock_t;
+typedef struct ArenaMark ArenaMark_t;
+
+/**
+ * @brief Config parameters for the #Arena.
+ * @class ArenaConfig
+ */
+struct ArenaConfig
+{
+    uint8_t * buffer; /**< The first block of memory to allocate from */
+    size_t buffer_size; /**< Size of the buffer in bytes */
+    IPoolAllocator_t const * block_allocator; /**< Allocator to take more blocks from when the current block is full, set to NULL to only use the buffer */
+    size_t block_size; /**< Size in bytes of each object from the block allocator, the start of each is used for an #ArenaBlock header. Ignored if there is no block allocator */
+};
+
+/**
+ * @brief Header at the start of every block taken from the block allocator.
+ */
+struct ArenaBlock
+{
+    ArenaBlock_t * previous; /**< The block in use before this one, NULL if that was the buffer */
+};
+
+/**
+ * @brief A saved position of an #Arena, everything allocated after it can be released at once.
+ * @class ArenaMark
+ */
+struct ArenaMark
+{
+    ArenaBlock_t * block; /**< The chained block in use, NULL for the buffer */
+    uint8_t * cursor; /**< The next free byte in that block */
+    size_t generation; /**< Number of times the arena had been reset when the mark was taken */
+};
+
+/**
+ * @brief A bump allocator, which hands out memory by advancing an offset and cannot free individual allocations.
+ *
+ * Allocations are released by returning the arena to a mark taken earlier, or by resetting it completely. Marks nest,
+ * so a request handler can take a mark, allocate its temporaries, and reset to the mark when it is done, leaving any
+ * allocations made before the request untouched.
+ *
+ * With a block allocator, the arena chains additional fixed size blocks once the buffer is full. Each block records the
+ * block before it, so resetting walks back along the chain returning the blocks to the block allocator. Without a block
+ * allocator, allocation fails once the buffer is full and resetting is always O(1).
+ *
+ * A mark stays valid until the arena is reset to a position before it. Each reset is counted, so a mark taken before
+ * the last reset is checked against where that reset went, even if later allocations have moved past the mark again.
+ *
+ * @class Arena
+ */
+struct Arena
+{
+    uint8_t * buffer;
+    size_t buffer_size;
+    IPoolAllocator_t block_allocator;
+    size_t block_size;
+    ArenaBlock_t * block; /**< The chained block in use, NULL while allocating from the buffer */
+    uint8_t * cursor; /**< The next free byte in the current block */
+    uint8_t * end; /**< The end of the current block */
+    size_t generation; /**< Number of times the arena has been reset */
+    ArenaMark_t reset_position; /**< Where the last reset returned the arena to */
+};
+
+/**
+ * @brief  Initialises an arena with the provided config.
+ *
+ * @param[in] arena - The pointer to the arena
+ * @param[in] config - The arena's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The buffer is empty, or the block size cannot hold a block header
+ *
+ * @memberof Arena
+ */
+ErrorCode_t arena_init(Arena_t * arena, ArenaConfig_t const * config);
+
+/**
+ * @brief  De-initialises an arena, returning every chained block to the block allocator.
+ *
+ * @param[in] arena - The pointer to the arena
+ *
+ * @memberof Arena
+ */
+void arena_deinit(Arena_t * arena);
+
+/**
+ * @brief  Allocates size bytes from the arena.
+ *
+ * @param[in] arena - The pointer to the arena
+ * @param[in] size - Number of bytes to allocate
+ * @param[in] alignment - Alignment of the allocation in bytes, must be a power of 2
+ * @param[inout] object_ptr - The pointer to the allocation
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The alignment is not a power of 2
+ * @retval #ERR_NO_MEM - The current block is full, and no block could be chained that fits the allocation
+ *
+ * @memberof Arena
+ */
+ErrorCode_t arena_allocate(Arena_t * arena, size_t size, size_t alignment, void ** object_ptr);
+
+/**
+ * @brief  Saves the current position of the arena.
+ *
+ * @param[in] arena - The pointer to the arena
+ * @param[out] mark - Set to the current position
+ *
+ * @memberof Arena
+ */
+void arena_mark(Arena_t const * arena, ArenaMark_t * mark);
+
+/**
+ * @brief  Releases every allocation made since the mark was taken.
+ *
+ * @param[in] arena - The pointer to the arena
+ * @param[in] mark - A mark taken from this arena
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The mark is not from this arena, is past the current position, or is past the position of
+ *                            the last reset made after it was taken
+ *
+ * @note Only the last reset is checked, a mark released by an earlier reset is not detected once a later reset returns
+ * the arena to a position past it.
+ *
+ * @memberof Arena
+ */
+ErrorCode_t arena_reset_to_mark(Arena_t * arena, ArenaMark_t const * mark);
+
+/**
+ * @brief  Releases every allocation, returning the arena to its state after init.
+ *
+ * @param[in] arena - The pointer to the arena
+ *
+ * @memberof Arena
+ */
+void arena_reset(Arena_t * arena);
+
+/**
+ * @brief  Gets the number of bytes left in the current block.
+ *
+ * @param[in] arena - The pointer to the arena
+ *
+ * @returns The bytes left, alignment padding may make the largest allocation smaller than this
+ *
+ * @memberof Arena
+ */
+size_t arena_get_remaining(Arena_t const * arena);
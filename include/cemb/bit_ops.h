@@ -18,3 +18,35 @@
  */
 uint32_t bit_ops_hamming_weight_u32(uint32_t i);
 
+/**
+ * @brief Counts the number of '0' bits below the lowest '1' bit.
+ *
+ * For example, 0b11100 has 2 trailing zeros.
+ *
+ * @param[in] i
+ *
+ * @returns The number of trailing zeros, or 32 if i is 0.
+ */
+uint32_t bit_ops_count_trailing_zeros_u32(uint32_t i);
+
+/**
+ * @brief Finds the position of the lowest '1' bit, counting from 1 like the POSIX ffs.
+ *
+ * For example, 0b11100 returns 3.
+ *
+ * @param[in] i
+ *
+ * @returns The 1 based position of the lowest set bit, or 0 if i is 0.
+ */
+uint32_t bit_ops_find_first_set_u32(uint32_t i);
+
+/**
+ * @brief Finds the position of the highest '1' bit, counting from 1 like the BSD fls.
+ *
+ * For example, 0b11100 returns 5.
+ *
+ * @param[in] i
+ *
+ * @returns The 1 based position of the highest set bit, or 0 if i is 0.
+ */
+uint32_t bit_ops_find_last_set_u32(uint32_t i);
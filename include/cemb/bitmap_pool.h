@@ -0,0 +1,143 @@
+/**
+ * @file
+ * @brief A statically allocated object pool that tracks free objects with one bit each.
+ *
+ * Does not take into account threaded operations, as this pool does not lock.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+
+/**
+ * @brief Number of bitmap words needed to track the given number of objects.
+ */
+#define BITMAP_POOL_BITMAP_WORD_COUNT(object_count) (((object_count) + 31) / 32)
+
+typedef struct BitmapPool BitmapPool_t;
+typedef struct BitmapPoolConfig BitmapPoolConfig_t;
+
+/**
+ * @brief Config parameters for the #BitmapPool.
+ * @class BitmapPoolConfig
+ */
+struct BitmapPoolConfig
+{
+    uint8_t * buffer; /**< The buffer holding the objects */
+    size_t buffer_size; /**< Size of the buffer in bytes, must be at least object_size * object_count */
+    size_t object_size; /**< Size of each object in bytes. */
+    size_t object_count; /**< Number of objects this pool manages. */
+    uint32_t * bitmap; /**< One bit per object, must have BITMAP_POOL_BITMAP_WORD_COUNT(object_count) words */
+    size_t bitmap_word_count; /**< Number of words in the bitmap */
+};
+
+/**
+ * @brief A pool of fixed size objects, where a set bit in the bitmap marks a free object.
+ *
+ * Allocation searches for a non zero word and takes its lowest set bit, starting from the word last used so a mostly
+ * full pool does not rescan its full words. Deallocation turns the pointer into an index, so a pointer can be checked
+ * for ownership and for being currently allocated without a search. This catches stray and double frees that would
+ * otherwise corrupt the pool.
+ *
+ * @class BitmapPool
+ */
+struct BitmapPool
+{
+    uint8_t * buffer;
+    uint32_t * bitmap;
+    size_t bitmap_word_count;
+    size_t object_size;
+    size_t object_count;
+    size_t available_count;
+    size_t search_word; /**< Word the next allocation starts searching from */
+};
+
+/**
+ * @brief  Gets the pool allocator interface corresponding to this pool.
+ *
+ * @param[in] pool - The pool to create the interface for
+ * @param[in] interface - The interface to configure
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof BitmapPool
+ */
+ErrorCode_t bitmap_pool_as_i_pool_allocator(BitmapPool_t * pool, IPoolAllocator_t * interface);
+
+/**
+ * @brief  Initialises a bitmap pool with every object free.
+ *
+ * @param[in] pool - The pointer to the pool object
+ * @param[in] config - The pool's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The provided configuration is invalid
+ *
+ * @memberof BitmapPool
+ */
+ErrorCode_t bitmap_pool_init(BitmapPool_t * pool, BitmapPoolConfig_t const * config);
+
+/**
+ * @brief  De-initialises a bitmap pool.
+ *
+ * @param[in] pool - The pointer to the pool object
+ *
+ * @memberof BitmapPool
+ */
+void bitmap_pool_deinit(BitmapPool_t * pool);
+
+/**
+ * @brief  Requests an object from the pool.
+ *
+ * @param[in] pool - The pointer to the pool object
+ * @param[inout] object_ptr - The pointer to the object acquired.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - No slots are available
+ *
+ * @memberof BitmapPool
+ */
+ErrorCode_t bitmap_pool_allocate(BitmapPool_t * pool, void ** object_ptr);
+
+/**
+ * @brief  Frees an object for reuse, after checking it is an allocated object of this pool.
+ *
+ * @param[in] pool - The pointer to the pool object
+ * @param[inout] object_ptr - The object to free. The pointer provided will return to NULL after freeing, and is left
+ *                            unchanged if the free is rejected.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is NULL, outside of the buffer, or not the start of an object.
+ * @retval #ERR_INVALID_STATE - The object is already free, this is a double free.
+ *
+ * @memberof BitmapPool
+ */
+ErrorCode_t bitmap_pool_deallocate(BitmapPool_t * pool, void ** object_ptr);
+
+/**
+ * @brief  Checks if a pointer is an object of this pool that is currently allocated.
+ *
+ * @param[in] pool - The pointer to the pool object
+ * @param[in] object - The pointer to check, can be NULL.
+ *
+ * @retval #ERR_NONE - The object is allocated
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is NULL, outside of the buffer, or not the start of an object.
+ * @retval #ERR_INVALID_STATE - The object is free
+ *
+ * @memberof BitmapPool
+ */
+ErrorCode_t bitmap_pool_check(BitmapPool_t const * pool, void const * object);
+
+/**
+ * @brief  Gets the number of remaining slots in the pool.
+ *
+ * @param[in] pool  - The pointer to the pool object
+ *
+ * @returns The number of unused slots in the pool
+ *
+ * @memberof BitmapPool
+ */
+size_t bitmap_pool_get_available_count(BitmapPool_t * pool);
@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @brief Contains a blocking wrapper around the copy queue, for threads that should sleep rather than poll.
+ *
+ * This module depends on POSIX threads, and is only built when CEMB_CFG_PRODUCE_BLOCKING_QUEUE is enabled.
+ */
+#pragma once
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "copy_queue.h"
+#include "error_codes.h"
+
+/**
+ * @brief Timeout value that waits until the request can be completed.
+ */
+#define BLOCKING_COPY_QUEUE_WAIT_FOREVER (UINT32_MAX)
+
+typedef struct BlockingCopyQueue BlockingCopyQueue_t;
+
+/**
+ * @brief A copy queue where enqueues wait for space and dequeues wait for data, up to a timeout.
+ *
+ * Waiting threads sleep on a condition variable and are only signalled when the queue changes from empty to not empty
+ * (or full to not full) while a thread is waiting. A burst of enqueues to an empty queue therefore wakes a single
+ * consumer, which passes the wake on to the next waiting consumer if elements remain after its dequeue.
+ *
+ * @note Init and deinit are not thread safe, and the queue must not be used after deinit.
+ */
+struct BlockingCopyQueue
+{
+    CopyQueue_t queue;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    size_t waiting_consumers;
+    size_t waiting_producers;
+    size_t wake_count; /**< Number of times a waiting thread was signalled */
+};
+
+/**
+ * @brief Initialises a blocking copy queue.
+ *
+ * @param[in] queue - the queue to use
+ * @param[in] config - the queue's configuration, see #CopyQueueConfig
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG
+ * @retval #ERR_NO_MEM - the synchronisation primitives could not be created
+ *
+ * @memberof BlockingCopyQueue
+ */
+ErrorCode_t blocking_copy_queue_init(BlockingCopyQueue_t * queue, CopyQueueConfig_t const * config);
+
+/**
+ * @brief Deinitialises a queue, no threads may be waiting on the queue.
+ *
+ * @param[in] queue - the queue to use
+ *
+ * @memberof BlockingCopyQueue
+ */
+void blocking_copy_queue_deinit(BlockingCopyQueue_t * queue);
+
+/**
+ * @brief Copies an element into the queue, waiting for space if the queue is full.
+ *
+ * @param[in] queue - the queue to use
+ * @param[in] element - The element to copy into the queue, must be the type the queue was initialised with.
+ * @param[in] timeout_ms - Milliseconds to wait for space, 0 does not wait, #BLOCKING_COPY_QUEUE_WAIT_FOREVER never
+ *                         times out.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_TIMEOUT - queue was still full when the timeout expired
+ *
+ * @memberof BlockingCopyQueue
+ */
+ErrorCode_t blocking_copy_queue_enqueue_timed(BlockingCopyQueue_t * queue, void const * element, uint32_t timeout_ms);
+
+/**
+ * @brief Copies the next element out of the queue, waiting for one if the queue is empty.
+ *
+ * @param[in] queue - the queue to use
+ * @param[inout] element - the element to save the queue to. Must be of the type the queue was initialised to.
+ * @param[in] timeout_ms - Milliseconds to wait for an element, 0 does not wait, #BLOCKING_COPY_QUEUE_WAIT_FOREVER
+ *                         never times out.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_TIMEOUT - queue was still empty when the timeout expired
+ *
+ * @memberof BlockingCopyQueue
+ */
+ErrorCode_t blocking_copy_queue_dequeue_timed(BlockingCopyQueue_t * queue, void * element, uint32_t timeout_ms);
+
+/**
+ * @brief Gets the number of items in the queue.
+ *
+ * @param[in] queue - the queue to use
+ *
+ * @returns The number of items in the queue, which may be stale as soon as it is returned.
+ *
+ * @memberof BlockingCopyQueue
+ */
+size_t blocking_copy_queue_get_size(BlockingCopyQueue_t * queue);
+
+/**
+ * @brief Gets the number of times a waiting thread has been signalled, useful to observe wakeup coalescing.
+ *
+ * @param[in] queue - the queue to use
+ *
+ * @returns The number of wakes sent since initialisation.
+ *
+ * @memberof BlockingCopyQueue
+ */
+size_t blocking_copy_queue_get_wake_count(BlockingCopyQueue_t * queue);
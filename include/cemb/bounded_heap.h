@@ -33,6 +33,7 @@ struct BoundedHeapConfig {
     void ** heap_storage; /**< Underlying buffer to store the values */
     size_t element_count; /**< The number of elements to store */
     BoundedHeapCompareFunc_t compare; /* Heap's compare function, used to determine ordering. */
+    size_t arity; /**< Number of children per node, a power of 2. Set to 0 for a binary heap. See #BoundedHeap. */
 };
 
 /**
@@ -40,9 +41,15 @@ struct BoundedHeapConfig {
  * 
  * @note Note this heap does NOT store any data, it simply stores pointers to data that the user provides. The ownership
  * of the items in the heap is the sole responsibility of the owner of the heap.
+ *
+ * A wider arity gives a shallower tree, so a pop sifts through fewer levels at the cost of comparing more children at
+ * each one. An arity of 4 makes the same number of compare calls as a binary heap over half the levels. As the children
+ * of a node are stored next to each other, an arity of 8 puts them in one 64 byte cache line when &heap_storage[1] is
+ * aligned to the line, which suits large heaps that miss the cache more than they spend in the compare function.
  */
 struct BoundedHeap {
     BoundedHeapConfig_t config; /**<*/
+    size_t arity_shift; /**< log2 of the arity, so child and parent indexes are found with shifts. */
     size_t items_in_heap;
     size_t heap_max_size; /**< for correct deinit, we use this to determine the actual max item size of the heap. */
 };
@@ -54,7 +61,7 @@ struct BoundedHeap {
  * @param[in] config - the config to set the heap
  *
  * @retval #ERR_NONE
- * @retval #ERR_INVALID_ARG
+ * @retval #ERR_INVALID_ARG - The heap holds no elements, or the arity is not a power of 2.
  * 
  * @memberof BoundedHeap
  */
@@ -112,6 +119,54 @@ ErrorCode_t bounded_heap_pop(BoundedHeap_t * heap, void ** heap_item);
  */
 ErrorCode_t bounded_heap_push(BoundedHeap_t * heap, void * heap_item);
 
+/**
+ * @brief Adds a number of items to the heap at once.
+ *
+ * The items are appended and the whole heap is ordered bottom up, which takes O(n) compares rather than the
+ * O(n log n) of pushing them one at a time. Best suited to loading an empty heap.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[in] heap_items - The items to add, must have count items
+ * @param[in] count - Number of items to add
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - The heap does not have space for all of the items, none were added
+ *
+ * @memberof BoundedHeap
+ */
+ErrorCode_t bounded_heap_build(BoundedHeap_t * heap, void * const * heap_items, size_t count);
+
+/**
+ * @brief Pushes an item then pops the root, with at most one sift.
+ *
+ * If the item belongs above the root (or the heap is empty) it is handed straight back and the heap is unchanged.
+ * Otherwise the root is popped and the item takes its place.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[in] heap_item - The item to push to the heap, can be a NULL
+ * @param[out] popped_item - Set to the root of the heap after the push.
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof BoundedHeap
+ */
+ErrorCode_t bounded_heap_pushpop(BoundedHeap_t * heap, void * heap_item, void ** popped_item);
+
+/**
+ * @brief Pops the root then pushes an item, with a single sift. Unlike #bounded_heap_pushpop, the popped item is always
+ *        the previous root, even if the new item belongs above it.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[in] heap_item - The item to push to the heap, can be a NULL
+ * @param[out] popped_item - Set to the root of the heap before the push.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - The heap is empty, the item was not pushed
+ *
+ * @memberof BoundedHeap
+ */
+ErrorCode_t bounded_heap_replace_top(BoundedHeap_t * heap, void * heap_item, void ** popped_item);
+
 /**
  * @brief Gets the number of items that can be placed in the heap.
  * 
@@ -0,0 +1,156 @@
+/**
+ * @file
+ * @brief A buddy allocator handing out power of 2 sized blocks from a static buffer.
+ *
+ * Does not take into account threaded operations, as this allocator does not lock.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+
+/**
+ * @brief Maximum number of block sizes, from the whole buffer down to the minimum block.
+ */
+#define BUDDY_ALLOCATOR_MAX_LEVELS (32)
+
+/**
+ * @brief Number of bitmap words needed for a buffer split down to the given minimum block size.
+ *
+ * The blocks form a binary tree with one node per possible block, and each node has a split bit and a free bit.
+ */
+#define BUDDY_ALLOCATOR_BITMAP_WORD_COUNT(buffer_size, min_block_size)                                                  \
+    (2 * (((2 * ((buffer_size) / (min_block_size))) - 1 + 31) / 32))
+
+typedef struct BuddyAllocator BuddyAllocator_t;
+typedef struct BuddyAllocatorConfig BuddyAllocatorConfig_t;
+typedef struct BuddyFreeBlock BuddyFreeBlock_t;
+
+/**
+ * @brief Config parameters for the #BuddyAllocator.
+ * @class BuddyAllocatorConfig
+ */
+struct BuddyAllocatorConfig
+{
+    uint8_t * buffer; /**< The buffer to split into blocks, should be aligned to min_block_size */
+    size_t buffer_size; /**< Size of the buffer in bytes, must be a power of 2 no larger than 2^31 */
+    size_t min_block_size; /**< Smallest block handed out, must be a power of 2 that can hold a #BuddyFreeBlock */
+    uint32_t * bitmap; /**< Must have BUDDY_ALLOCATOR_BITMAP_WORD_COUNT(buffer_size, min_block_size) words */
+    size_t bitmap_word_count; /**< Number of words in the bitmap */
+};
+
+/**
+ * @brief Free list links, stored in the first bytes of each free block.
+ */
+struct BuddyFreeBlock
+{
+    BuddyFreeBlock_t * next;
+    BuddyFreeBlock_t * previous;
+};
+
+/**
+ * @brief An allocator that splits the buffer into halves until a block fits the request, and merges them back on free.
+ *
+ * Every block is a power of 2 in size and aligned to its size, so each block has exactly one buddy, the other half of
+ * the block it was split from. A block's address and level locate its node in a binary tree of all possible blocks,
+ * where the bitmap records which nodes are split and which are free. Finding the size of a freed block is a walk up
+ * to its first split ancestor, and a freed block merges with its buddy whenever the buddy is free, so both allocate and deallocate
+ * take at most one step per level.
+ *
+ * Free blocks of each level are kept in a doubly linked list threaded through the blocks themselves, so a buddy can be
+ * removed from its list without a search.
+ *
+ * @class BuddyAllocator
+ */
+struct BuddyAllocator
+{
+    uint8_t * buffer;
+    size_t buffer_size;
+    uint32_t buffer_size_log2;
+    uint32_t level_count; /**< Number of block sizes, level 0 is the whole buffer */
+    uint32_t * split_bitmap; /**< Set for nodes that have been split into two children */
+    uint32_t * free_bitmap; /**< Set for nodes that are a free block in a free list */
+    size_t free_bytes;
+    BuddyFreeBlock_t * free_lists[BUDDY_ALLOCATOR_MAX_LEVELS];
+};
+
+/**
+ * @brief  Gets the pool allocator interface corresponding to this allocator.
+ *
+ * The unsized allocate requests a block of min_block_size, so the allocator can back wrappers that only allocate
+ * unsized, such as a #PoolMagazine. The available count is the number of free bytes.
+ *
+ * @param[in] buddy - The allocator to create the interface for
+ * @param[in] interface - The interface to configure
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof BuddyAllocator
+ */
+ErrorCode_t buddy_allocator_as_i_pool_allocator(BuddyAllocator_t * buddy, IPoolAllocator_t * interface);
+
+/**
+ * @brief  Initialises the allocator with the whole buffer as a single free block.
+ *
+ * @param[in] buddy - The pointer to the allocator
+ * @param[in] config - The allocator's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - A size is not a power of 2, the minimum block is too small, there are too many levels, or
+ *                            the bitmap is too small
+ *
+ * @memberof BuddyAllocator
+ */
+ErrorCode_t buddy_allocator_init(BuddyAllocator_t * buddy, BuddyAllocatorConfig_t const * config);
+
+/**
+ * @brief  De-initialises the allocator.
+ *
+ * @param[in] buddy - The pointer to the allocator
+ *
+ * @memberof BuddyAllocator
+ */
+void buddy_allocator_deinit(BuddyAllocator_t * buddy);
+
+/**
+ * @brief  Allocates the smallest block that holds size bytes.
+ *
+ * @param[in] buddy - The pointer to the allocator
+ * @param[in] size - Number of bytes requested, rounded up to a power of 2 and at least the minimum block size
+ * @param[inout] object_ptr - The pointer to the block
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - No free block is large enough
+ * @retval #ERR_INVALID_ARG - The size is 0, or larger than the buffer
+ *
+ * @memberof BuddyAllocator
+ */
+ErrorCode_t buddy_allocator_allocate(BuddyAllocator_t * buddy, size_t size, void ** object_ptr);
+
+/**
+ * @brief  Frees a block, merging it with its buddy for as long as the buddy is free.
+ *
+ * @param[in] buddy - The pointer to the allocator
+ * @param[inout] object_ptr - The block to free. The pointer provided will return to NULL after freeing.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is not the start of a block in the buffer
+ * @retval #ERR_INVALID_STATE - The block is already free
+ *
+ * @memberof BuddyAllocator
+ */
+ErrorCode_t buddy_allocator_deallocate(BuddyAllocator_t * buddy, void ** object_ptr);
+
+/**
+ * @brief  Gets the number of bytes in free blocks.
+ *
+ * @param[in] buddy - The pointer to the allocator
+ *
+ * @returns The free bytes, a single allocation may be limited to less than this by how the free blocks are split
+ *
+ * @memberof BuddyAllocator
+ */
+size_t buddy_allocator_get_free_bytes(BuddyAllocator_t * buddy);
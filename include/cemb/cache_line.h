@@ -0,0 +1,12 @@
+/**
+ * @file
+ * @brief Cache line sizing used to keep data accessed by different cores apart.
+ *
+ * The default suits most desktop and server class processors, targets with a different line size (or no cache at all)
+ * can override it by defining CEMB_CACHE_LINE_SIZE before including any header from this library.
+ */
+#pragma once
+
+#ifndef CEMB_CACHE_LINE_SIZE
+#define CEMB_CACHE_LINE_SIZE (64)
+#endif
@@ -88,6 +88,52 @@ ErrorCode_t circular_buffer_push_byte(CircularBuffer_t * buffer, uint8_t byte);
  */
 ErrorCode_t circular_buffer_pop_byte(CircularBuffer_t * buffer, uint8_t * byte);
 
+/**
+ * @brief Pushes a block of bytes onto the circular buffer.
+ *
+ * Copies the block in at most two segments (split at the end of the buffer). Like #circular_buffer_push_byte, the
+ * oldest bytes are overridden if there is insufficient space. If the block is larger than the buffer, only the last
+ * bytes of the block that fit are kept.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[in] bytes - the bytes to push, can be NULL if length is 0
+ * @param[in] length - number of bytes to push
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - buffer has no space to push bytes (mostly likely because it has been deinitialised)
+ *
+ * @memberof CircularBuffer
+ */
+ErrorCode_t circular_buffer_push(CircularBuffer_t * buffer, uint8_t const * bytes, size_t length);
+
+/**
+ * @brief Pops up to length bytes from the circular buffer.
+ *
+ * Copies the bytes out in at most two segments (split at the end of the buffer).
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[inout] bytes - the location to store the popped bytes, must fit at least length bytes
+ * @param[in] length - maximum number of bytes to pop
+ *
+ * @returns Number of bytes popped, which is less than length if the buffer did not have enough bytes.
+ *
+ * @memberof CircularBuffer
+ */
+size_t circular_buffer_pop(CircularBuffer_t * buffer, uint8_t * bytes, size_t length);
+
+/**
+ * @brief Copies up to length bytes from the circular buffer without removing them.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[inout] bytes - the location to store the peeked bytes, must fit at least length bytes
+ * @param[in] length - maximum number of bytes to peek
+ *
+ * @returns Number of bytes peeked, which is less than length if the buffer did not have enough bytes.
+ *
+ * @memberof CircularBuffer
+ */
+size_t circular_buffer_peek(CircularBuffer_t const * buffer, uint8_t * bytes, size_t length);
+
 /**
  * @brief Gets the number of items within the buffer.
  * 
@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @brief A statically allocated object pool that is safe to share between threads without a lock.
+ */
+#pragma once
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "cache_line.h"
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+
+typedef struct ConcurrentPool ConcurrentPool_t;
+typedef struct ConcurrentPoolConfig ConcurrentPoolConfig_t;
+
+/**
+ * @brief Config parameters for the #ConcurrentPool.
+ * @class ConcurrentPoolConfig
+ */
+struct ConcurrentPoolConfig
+{
+    uint8_t * buffer; /**< The buffer holding the objects */
+    size_t buffer_size; /**< Size of the buffer in bytes, must be at least object_size * object_count */
+    size_t object_size; /**< Size of each object in bytes. */
+    size_t object_count; /**< Number of objects this pool manages, must be less than UINT32_MAX */
+    atomic_size_t * link_buffer; /**< One free list link per object. Must have object_count items. */
+};
+
+/**
+ * @brief A pool of fixed size objects, where allocate and deallocate are lock free.
+ *
+ * Free objects form a Treiber stack. Each object has a link holding the index of the next free object, and the head
+ * packs the index of the top object together with a version tag into a single 64 bit word. Every successful update
+ * increments the tag, so a thread that read the head before another thread popped and pushed the same object fails its
+ * compare and swap instead of installing a stale link (the ABA problem).
+ *
+ * Links are kept outside the objects, so a thread reading a stale link never races with the owner writing its object.
+ *
+ * @note Init and deinit are not thread safe, and must be called while no other thread is using the pool.
+ *
+ * @class ConcurrentPool
+ */
+struct ConcurrentPool
+{
+    uint8_t * buffer;
+    atomic_size_t * links;
+    size_t object_size;
+    size_t object_count;
+    alignas(CEMB_CACHE_LINE_SIZE) atomic_uint_least64_t head; /**< Tag in the upper 32 bits, top index + 1 in the lower 32 bits, 0 when empty */
+    atomic_size_t available_count;
+};
+
+/**
+ * @brief  Gets the pool allocator interface corresponding to this pool.
+ *
+ * @param[in] pool - The pool to create the interface for
+ * @param[in] interface - The interface to configure
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof ConcurrentPool
+ */
+ErrorCode_t concurrent_pool_as_i_pool_allocator(ConcurrentPool_t * pool, IPoolAllocator_t * interface);
+
+/**
+ * @brief  Initialises a concurrent pool with the provided config.
+ *
+ * @param[in] pool - The pointer to the pool object
+ * @param[in] config - The pool's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The provided configuration is invalid
+ *
+ * @memberof ConcurrentPool
+ */
+ErrorCode_t concurrent_pool_init(ConcurrentPool_t * pool, ConcurrentPoolConfig_t const * config);
+
+/**
+ * @brief  De-initialises a concurrent pool.
+ *
+ * @param[in] pool - The pointer to the pool object
+ *
+ * @memberof ConcurrentPool
+ */
+void concurrent_pool_deinit(ConcurrentPool_t * pool);
+
+/**
+ * @brief  Requests an object from the pool, safe to call from any thread.
+ *
+ * @param[in] pool - The pointer to the pool object
+ * @param[inout] object_ptr - The pointer to the object acquired.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - No slots are available
+ *
+ * @memberof ConcurrentPool
+ */
+ErrorCode_t concurrent_pool_allocate(ConcurrentPool_t * pool, void ** object_ptr);
+
+/**
+ * @brief  Frees an object for reuse, safe to call from any thread.
+ *
+ * @param[in] pool - The pointer to the pool object
+ * @param[inout] object_ptr - The object to free back into the pool. The pointer provided will return to NULL after
+ *                            freeing.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is NULL, outside of the buffer, or not the start of an object.
+ *
+ * @memberof ConcurrentPool
+ */
+ErrorCode_t concurrent_pool_deallocate(ConcurrentPool_t * pool, void ** object_ptr);
+
+/**
+ * @brief  Gets the number of remaining slots in the pool.
+ *
+ * @param[in] pool  - The pointer to the pool object
+ *
+ * @returns The number of unused slots in the pool, which may be stale as soon as it is returned.
+ *
+ * @memberof ConcurrentPool
+ */
+size_t concurrent_pool_get_available_count(ConcurrentPool_t * pool);
@@ -24,6 +24,8 @@ struct CopyQueueConfig
 
 /**
  * @brief A queue which copies values into itself (removing the need to maintain the lifecycle).
+ *
+ * The elements are stored in a ring, so the queue can be used indefinitely without re-initialising.
  * 
  * @note This does a shallow copy only, for a deep copy use a different queue which provides a deep copy function. ( or
  *       allows passing in of a copy function).
@@ -34,8 +36,9 @@ struct CopyQueue
     size_t max_size;
     size_t element_size;
     uint8_t * buffer;
-    size_t tail_idx;
-    size_t head_idx;
+    size_t buffer_size; /**< Bytes of the buffer used by the ring, max_size * element_size */
+    size_t tail_idx; /**< Byte offset of the next element to enqueue */
+    size_t head_idx; /**< Byte offset of the next element to dequeue */
 };
 
 /**
@@ -86,6 +89,87 @@ ErrorCode_t copy_queue_enqueue(CopyQueue_t * queue, void const * element);
  */
 ErrorCode_t copy_queue_dequeue(CopyQueue_t * queue, void * element);
 
+/**
+ * @brief Gets the slot the next enqueued element will occupy, so the element can be constructed directly in the queue.
+ *
+ * The slot is only added to the queue once #copy_queue_commit is called. Calling this again before committing returns
+ * the same slot.
+ *
+ * @param[in] queue - the queue to use
+ * @param[out] slot - set to the slot within the queue buffer, which is element_size bytes long
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - queue is full
+ *
+ * @memberof CopyQueue
+ */
+ErrorCode_t copy_queue_reserve(CopyQueue_t * queue, void ** slot);
+
+/**
+ * @brief Adds the slot returned by #copy_queue_reserve to the back of the queue.
+ *
+ * @param[in] queue - the queue to use
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - queue is full, so there was no slot to commit
+ *
+ * @memberof CopyQueue
+ */
+ErrorCode_t copy_queue_commit(CopyQueue_t * queue);
+
+/**
+ * @brief Gets the slot of the next element to be dequeued, so it can be read directly from the queue.
+ *
+ * The slot remains valid until #copy_queue_release is called.
+ *
+ * @param[in] queue - the queue to use
+ * @param[out] slot - set to the slot within the queue buffer, which is element_size bytes long
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - The queue has no elements
+ *
+ * @memberof CopyQueue
+ */
+ErrorCode_t copy_queue_front(CopyQueue_t * queue, void ** slot);
+
+/**
+ * @brief Removes the element returned by #copy_queue_front from the queue, without copying it out.
+ *
+ * @param[in] queue - the queue to use
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - The queue has no elements
+ *
+ * @memberof CopyQueue
+ */
+ErrorCode_t copy_queue_release(CopyQueue_t * queue);
+
+/**
+ * @brief Places as many elements as there is space for in the queue, copying them in at most two segments.
+ *
+ * @param[in] queue - the queue to use
+ * @param[in] elements - Array of elements to copy into the queue, can be NULL if element_count is 0.
+ * @param[in] element_count - Number of elements in the array
+ *
+ * @returns The number of elements enqueued, which is less than element_count if the queue did not have enough space.
+ *
+ * @memberof CopyQueue
+ */
+size_t copy_queue_enqueue_n(CopyQueue_t * queue, void const * elements, size_t element_count);
+
+/**
+ * @brief Removes up to element_count of the next items from the queue, copying them out in at most two segments.
+ *
+ * @param[in] queue - the queue to use
+ * @param[inout] elements - Array to copy the elements to, must fit at least element_count elements.
+ * @param[in] element_count - Maximum number of elements to dequeue
+ *
+ * @returns The number of elements dequeued, which is less than element_count if the queue did not have enough elements.
+ *
+ * @memberof CopyQueue
+ */
+size_t copy_queue_dequeue_n(CopyQueue_t * queue, void * elements, size_t element_count);
+
 /**
  * @brief  Peeks at the next item that can be popped from the queue.
  * 
@@ -83,6 +83,68 @@ ErrorCode_t fast_circular_buffer_push_byte(FastCircularBuffer_t * buffer, uint8_
  */
 ErrorCode_t fast_circular_buffer_pop_byte(FastCircularBuffer_t * buffer, uint8_t * byte);
 
+/**
+ * @brief Reserves the largest contiguous free region of the buffer for writing in place.
+ *
+ * The caller may fill up to region_length bytes at region (e.g. from a DMA transfer or read()) and must then call
+ * #fast_circular_buffer_commit_write to make the bytes visible to the reader. Unlike
+ * #fast_circular_buffer_push_byte, reserved regions never override unread bytes. The region is only valid until the
+ * next write side call.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[inout] region - set to the start of the writable region
+ * @param[inout] region_length - set to the number of bytes that can be written to the region
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - buffer is full (or has been deinitialised)
+ *
+ * @memberof FastCircularBuffer
+ */
+ErrorCode_t fast_circular_buffer_reserve_write(FastCircularBuffer_t * buffer, uint8_t ** region, size_t * region_length);
+
+/**
+ * @brief Commits bytes written into a region obtained from #fast_circular_buffer_reserve_write.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[in] length - number of bytes written, must not exceed the reserved region length
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - length is larger than the free space in the buffer
+ *
+ * @memberof FastCircularBuffer
+ */
+ErrorCode_t fast_circular_buffer_commit_write(FastCircularBuffer_t * buffer, size_t length);
+
+/**
+ * @brief Acquires the largest contiguous region of unread bytes for reading in place.
+ *
+ * The caller may read up to region_length bytes at region and must then call #fast_circular_buffer_release_read to
+ * free the bytes consumed. The region is only valid until the next write side call.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[inout] region - set to the start of the readable region
+ * @param[inout] region_length - set to the number of bytes that can be read from the region
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - buffer is empty
+ *
+ * @memberof FastCircularBuffer
+ */
+ErrorCode_t fast_circular_buffer_acquire_read(FastCircularBuffer_t * buffer, uint8_t const ** region, size_t * region_length);
+
+/**
+ * @brief Releases bytes consumed from a region obtained from #fast_circular_buffer_acquire_read.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[in] length - number of bytes consumed, must not exceed the number of bytes in the buffer
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - length is larger than the number of bytes in the buffer
+ *
+ * @memberof FastCircularBuffer
+ */
+ErrorCode_t fast_circular_buffer_release_read(FastCircularBuffer_t * buffer, size_t length);
+
 /**
  *  @brief  Gets the number of items within the buffer.
  * 
@@ -46,6 +46,46 @@ typedef ErrorCode_t(*i_pool_allocate_allocate_t)(void * context, void ** object_
  */
 typedef ErrorCode_t(*i_pool_allocate_deallocate_t)(void * context, void ** object_ptr);
 
+/**
+ * @brief The generic function pointer that will allocate an object of at least the requested size, for allocators
+ * that serve more than one object size.
+ *
+ * @param[in] context - The pointer to the pool object, used by concrete.
+ * @param[in] size - The minimum size of the object in bytes.
+ * @param[inout] object_ptr - The pointer to the element allocated.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - No slots of a suitable size are available
+ * @retval #ERR_INVALID_ARG - The size is larger than any object the allocator serves
+ */
+typedef ErrorCode_t(*i_pool_allocate_allocate_sized_t)(void * context, size_t size, void ** object_ptr);
+
+/**
+ * @brief The generic function pointer that will allocate a number of objects at once, either all of them or none.
+ *
+ * @param[in] context - The pointer to the pool object, used by concrete.
+ * @param[out] object_ptrs - Set to the objects allocated, must have count items.
+ * @param[in] count - Number of objects to allocate.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - Fewer than count slots are available, no objects were allocated
+ */
+typedef ErrorCode_t(*i_pool_allocate_allocate_bulk_t)(void * context, void ** object_ptrs, size_t count);
+
+/**
+ * @brief The generic function pointer that will deallocate a number of objects at once.
+ *
+ * Every pointer is set to NULL after the call, as for a single deallocate.
+ *
+ * @param[in] context - The pointer to the pool object, used by concrete.
+ * @param[inout] object_ptrs - The objects to free, must have count items.
+ * @param[in] count - Number of objects to free.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - A token provided is out of bounds.
+ */
+typedef ErrorCode_t(*i_pool_allocate_deallocate_bulk_t)(void * context, void ** object_ptrs, size_t count);
+
 /**
  * @brief Function pointer to get the remaining slots in the pool.
  * 
@@ -58,7 +98,9 @@ typedef size_t(*i_pool_allocate_get_available_count_t)(void * context);
 /**
  * @brief An interface for a Pool Allocator.
  * 
- * Provides the interface needed for any pool allocator interface.
+ * Provides the interface needed for any pool allocator interface. Allocators with a single object size set
+ * allocate_sized to NULL. Allocators without a faster way to handle many objects at once set the bulk functions to
+ * NULL, and the bulk wrappers fall back to one call per object.
  */
 struct IPoolAllocator
 {
@@ -66,6 +108,9 @@ struct IPoolAllocator
     i_pool_allocate_allocate_t allocate;
     i_pool_allocate_deallocate_t deallocate;
     i_pool_allocate_get_available_count_t get_available_count;
+    i_pool_allocate_allocate_sized_t allocate_sized; /**< Optional, can be NULL */
+    i_pool_allocate_allocate_bulk_t allocate_bulk; /**< Optional, can be NULL */
+    i_pool_allocate_deallocate_bulk_t deallocate_bulk; /**< Optional, can be NULL */
 };
 
 /**
@@ -82,6 +127,22 @@ struct IPoolAllocator
  */
 ErrorCode_t i_pool_allocator_allocate(IPoolAllocator_t const * interface, void ** object_ptr);
 
+/**
+ * @brief Requests an object of at least the given size from the pool.
+ *
+ * @param[in] interface - The pointer to the pool object.
+ * @param[in] size - The minimum size of the object in bytes.
+ * @param[inout] object_ptr - The pointer to the element in the object pool.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - No slots of a suitable size are available
+ * @retval #ERR_INVALID_ARG - The size is larger than any object the allocator serves
+ * @retval #ERR_NOT_IMPLEMENTED - The allocator only serves a single object size
+ *
+ * @memberof IPoolAllocator
+ */
+ErrorCode_t i_pool_allocator_allocate_sized(IPoolAllocator_t const * interface, size_t size, void ** object_ptr);
+
 /**
  * @brief Frees an object for reuse in the future. Note all objects will be zeroed when freed.
  * 
@@ -96,6 +157,38 @@ ErrorCode_t i_pool_allocator_allocate(IPoolAllocator_t const * interface, void *
  */
 ErrorCode_t i_pool_allocator_deallocate(IPoolAllocator_t const * interface, void ** object_ptr);
 
+/**
+ * @brief Requests a number of objects from the pool, either all of them or none.
+ *
+ * If the pool has no bulk allocate, objects are allocated one at a time and returned again if one fails.
+ *
+ * @param[in] interface - The pointer to the pool object.
+ * @param[out] object_ptrs - Set to the objects allocated, must have count items.
+ * @param[in] count - Number of objects to allocate.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - Fewer than count slots are available, no objects were allocated
+ *
+ * @memberof IPoolAllocator
+ */
+ErrorCode_t i_pool_allocator_allocate_bulk(IPoolAllocator_t const * interface, void ** object_ptrs, size_t count);
+
+/**
+ * @brief Frees a number of objects. Every pointer is set back to NULL.
+ *
+ * If the pool has no bulk deallocate, objects are freed one at a time. Every object is attempted even if one fails.
+ *
+ * @param[in] interface - The pointer to the pool object
+ * @param[inout] object_ptrs - The objects to free, must have count items.
+ * @param[in] count - Number of objects to free.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - A token provided is out of bounds.
+ *
+ * @memberof IPoolAllocator
+ */
+ErrorCode_t i_pool_allocator_deallocate_bulk(IPoolAllocator_t const * interface, void ** object_ptrs, size_t count);
+
 /**
  * @brief Gets the number of remaining slots in the pool.
  * 
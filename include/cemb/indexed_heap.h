@@ -0,0 +1,169 @@
+/**
+ * @file
+ * @brief A bounded heap whose items can be found again by handle, to change their ordering or remove them.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "bounded_heap.h"
+#include "error_codes.h"
+
+typedef struct IndexedHeapEntry IndexedHeapEntry_t;
+typedef struct IndexedHeapConfig IndexedHeapConfig_t;
+typedef struct IndexedHeap IndexedHeap_t;
+
+/**
+ * @brief Identifies an item in an #IndexedHeap from when it is pushed until it is popped or removed.
+ */
+typedef size_t IndexedHeapHandle_t;
+
+/**
+ * @brief A slot of the heap, the item along with the handle it was pushed with.
+ */
+struct IndexedHeapEntry
+{
+    void * item;
+    IndexedHeapHandle_t handle;
+};
+
+/**
+ * @brief Configuration values for an #IndexedHeap
+ */
+struct IndexedHeapConfig
+{
+    IndexedHeapEntry_t * heap_storage; /**< Underlying buffer to store the items, must have element_count entries. */
+    size_t * position_storage; /**< Position of each handle in the heap, must have element_count entries. */
+    size_t element_count; /**< The number of elements to store */
+    BoundedHeapCompareFunc_t compare; /**< Heap's compare function, as for #BoundedHeap. */
+};
+
+/**
+ * @brief A bounded heap with stable handles.
+ *
+ * Alongside the heap, a position map records where each handle's item currently sits, and is updated as items move.
+ * This lets an item be re-sifted after its key changes, or removed, in O(log n) without searching the heap, such as
+ * when rescheduling or cancelling timers. Handles are in the range [0, element_count), and are reused once their item
+ * leaves the heap. The entries past the end of the heap hold the handles that are free.
+ *
+ * @note As with #BoundedHeap, the heap only stores pointers to the items, ownership stays with the user.
+ */
+struct IndexedHeap
+{
+    IndexedHeapConfig_t config;
+    size_t items_in_heap;
+    size_t heap_max_size;
+};
+
+/**
+ * @brief  Inits the heap for use
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[in] config - the config to set the heap
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The heap holds no elements.
+ *
+ * @memberof IndexedHeap
+ */
+ErrorCode_t indexed_heap_init(IndexedHeap_t * heap, IndexedHeapConfig_t const * config);
+
+/**
+ * @brief  Deinitialises the heap.
+ *
+ * @param[in] heap - pointer to the heap instance
+ *
+ * @memberof IndexedHeap
+ */
+void indexed_heap_deinit(IndexedHeap_t * heap);
+
+/**
+ * @brief Pushes an item into the heap.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[in] heap_item - The item to push to the heap, can be a NULL
+ * @param[out] handle - Set to the handle of the item, valid until the item is popped or removed. Can be NULL.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - The heap is full
+ *
+ * @memberof IndexedHeap
+ */
+ErrorCode_t indexed_heap_push(IndexedHeap_t * heap, void * heap_item, IndexedHeapHandle_t * handle);
+
+/**
+ * @brief  Peeks at the root item of the heap without removing it.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[out] heap_item - The variable to store the root of the heap at.
+ * @param[out] handle - Set to the handle of the root item. Can be NULL.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - The heap is empty
+ *
+ * @memberof IndexedHeap
+ */
+ErrorCode_t indexed_heap_peek(IndexedHeap_t const * heap, void ** heap_item, IndexedHeapHandle_t * handle);
+
+/**
+ * @brief Removes the root item of the heap, its handle is freed.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[out] heap_item - The variable to store the root of the heap at.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - The heap is empty
+ *
+ * @memberof IndexedHeap
+ */
+ErrorCode_t indexed_heap_pop(IndexedHeap_t * heap, void ** heap_item);
+
+/**
+ * @brief Sets the item of a handle and moves it to its place in the heap.
+ *
+ * Call this after changing the key of an item in place (passing the same item), or to replace the item outright.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[in] handle - The handle of the item to update
+ * @param[in] heap_item - The item to store for the handle
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The handle is not in the heap
+ *
+ * @memberof IndexedHeap
+ */
+ErrorCode_t indexed_heap_update_key(IndexedHeap_t * heap, IndexedHeapHandle_t handle, void * heap_item);
+
+/**
+ * @brief Removes the item of a handle from anywhere in the heap, its handle is freed.
+ *
+ * @param[in] heap - pointer to the heap instance
+ * @param[in] handle - The handle of the item to remove
+ * @param[out] heap_item - Set to the item removed. Can be NULL.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The handle is not in the heap
+ *
+ * @memberof IndexedHeap
+ */
+ErrorCode_t indexed_heap_remove(IndexedHeap_t * heap, IndexedHeapHandle_t handle, void ** heap_item);
+
+/**
+ * @brief Gets the number of items that can be placed in the heap.
+ *
+ * @returns Number of free spaces left in the heap
+ *
+ * @memberof IndexedHeap
+ */
+size_t indexed_heap_get_remaining(IndexedHeap_t const * heap);
+
+/**
+ * @brief  Gets the number of items in the heap.
+ *
+ * @returns The number of items in the heap
+ *
+ * @memberof IndexedHeap
+ */
+size_t indexed_heap_get_size(IndexedHeap_t const * heap);
@@ -0,0 +1,194 @@
+/**
+ * @file
+ * @brief Usage statistics recorded around any pool allocator, for sizing pools from real workloads.
+ *
+ * Recording is only compiled in when CEMB_CFG_POOL_INSTRUMENTATION is defined (the CMake option of the same name).
+ * Without it, the instrumented interface is the backing interface itself, so instrumentation can be left in place in
+ * production builds at no cost.
+ */
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+
+/**
+ * @brief Number of allocation latency buckets.
+ *
+ * Bucket 0 counts allocations taking 0 ticks, bucket n counts allocations taking [2^(n-1), 2^n) ticks, and the last
+ * bucket also counts anything slower.
+ */
+#define INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT (16)
+
+typedef struct InstrumentedPool InstrumentedPool_t;
+typedef struct InstrumentedPoolConfig InstrumentedPoolConfig_t;
+typedef struct InstrumentedPoolSnapshot InstrumentedPoolSnapshot_t;
+
+/**
+ * @brief Reads a free running timer, in any unit. Wrapping is handled as long as an allocation takes less than one
+ * full period.
+ *
+ * @returns The current tick count
+ */
+typedef uint32_t(*instrumented_pool_get_ticks_t)(void);
+
+/**
+ * @brief Config parameters for the #InstrumentedPool.
+ * @class InstrumentedPoolConfig
+ */
+struct InstrumentedPoolConfig
+{
+    IPoolAllocator_t const * backing_allocator; /**< The allocator to record statistics for */
+    instrumented_pool_get_ticks_t get_ticks; /**< Timer for the latency histogram, set to NULL to skip timing */
+};
+
+/**
+ * @brief A copy of the statistics of an #InstrumentedPool at one point in time.
+ * @class InstrumentedPoolSnapshot
+ */
+struct InstrumentedPoolSnapshot
+{
+    size_t allocate_count; /**< Successful allocations */
+    size_t failure_count; /**< Allocations the backing allocator refused */
+    size_t deallocate_count; /**< Successful deallocations */
+    size_t in_use_count; /**< Objects currently allocated through this pool */
+    size_t high_water_mark; /**< Most objects allocated through this pool at once */
+    size_t latency_histogram[INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT]; /**< Successful allocations by ticks taken */
+};
+
+/**
+ * @brief A wrapper around a pool allocator that records how it is used.
+ *
+ * Counters are atomics updated with relaxed ordering, so a metrics thread can take a snapshot while other threads use
+ * the pool without a lock. Counters are read one by one, so a snapshot taken while other threads allocate may be
+ * slightly behind on some counters. The in use count is kept as its own counter rather than derived from the totals,
+ * as totals read one after the other can disagree, and the high water mark is raised from the count each allocation
+ * makes, so it never exceeds the objects the backing allocator has handed out.
+ *
+ * @class InstrumentedPool
+ */
+struct InstrumentedPool
+{
+    IPoolAllocator_t backing_allocator;
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    instrumented_pool_get_ticks_t get_ticks;
+    atomic_size_t allocate_count;
+    atomic_size_t failure_count;
+    atomic_size_t deallocate_count;
+    atomic_size_t in_use_count;
+    atomic_size_t high_water_mark;
+    atomic_size_t latency_histogram[INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT];
+#endif
+};
+
+/**
+ * @brief  Gets the pool allocator interface to allocate through, so allocations are recorded.
+ *
+ * Without CEMB_CFG_POOL_INSTRUMENTATION this is a copy of the backing allocator's interface.
+ *
+ * @param[in] pool - The instrumented pool to create the interface for
+ * @param[in] interface - The interface to configure
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof InstrumentedPool
+ */
+ErrorCode_t instrumented_pool_as_i_pool_allocator(InstrumentedPool_t * pool, IPoolAllocator_t * interface);
+
+/**
+ * @brief  Initialises an instrumented pool with all statistics at 0.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ * @param[in] config - The instrumented pool's configuration
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof InstrumentedPool
+ */
+ErrorCode_t instrumented_pool_init(InstrumentedPool_t * pool, InstrumentedPoolConfig_t const * config);
+
+/**
+ * @brief  De-initialises an instrumented pool.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ *
+ * @memberof InstrumentedPool
+ */
+void instrumented_pool_deinit(InstrumentedPool_t * pool);
+
+/**
+ * @brief  Allocates an object from the backing allocator, recording the outcome and the time taken.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ * @param[inout] object_ptr - The pointer to the object
+ *
+ * @retval #ERR_NONE
+ * @retval Any error of the backing allocator
+ *
+ * @memberof InstrumentedPool
+ */
+ErrorCode_t instrumented_pool_allocate(InstrumentedPool_t * pool, void ** object_ptr);
+
+/**
+ * @brief  Allocates an object of at least the given size from the backing allocator, recording as for
+ * #instrumented_pool_allocate.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ * @param[in] size - The minimum size of the object in bytes
+ * @param[inout] object_ptr - The pointer to the object
+ *
+ * @retval #ERR_NONE
+ * @retval Any error of the backing allocator, which is #ERR_NOT_IMPLEMENTED if it only serves one size
+ *
+ * @memberof InstrumentedPool
+ */
+ErrorCode_t instrumented_pool_allocate_sized(InstrumentedPool_t * pool, size_t size, void ** object_ptr);
+
+/**
+ * @brief  Returns an object to the backing allocator.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ * @param[inout] object_ptr - The object to free. The pointer provided will return to NULL after freeing.
+ *
+ * @retval #ERR_NONE
+ * @retval Any error of the backing allocator
+ *
+ * @memberof InstrumentedPool
+ */
+ErrorCode_t instrumented_pool_deallocate(InstrumentedPool_t * pool, void ** object_ptr);
+
+/**
+ * @brief  Gets the available count of the backing allocator.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ *
+ * @returns The backing allocator's available count
+ *
+ * @memberof InstrumentedPool
+ */
+size_t instrumented_pool_get_available_count(InstrumentedPool_t * pool);
+
+/**
+ * @brief  Copies the current statistics, safe to call from any thread.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ * @param[out] snapshot - Set to the current statistics
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NOT_IMPLEMENTED - Instrumentation is not compiled in, the snapshot is all 0
+ *
+ * @memberof InstrumentedPool
+ */
+ErrorCode_t instrumented_pool_get_snapshot(InstrumentedPool_t * pool, InstrumentedPoolSnapshot_t * snapshot);
+
+/**
+ * @brief  Restarts the high water mark from the current in use count, to find the peak of the next period.
+ *
+ * @param[in] pool - The pointer to the instrumented pool
+ *
+ * @memberof InstrumentedPool
+ */
+void instrumented_pool_reset_high_water_mark(InstrumentedPool_t * pool);
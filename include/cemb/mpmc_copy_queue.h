@@ -0,0 +1,108 @@
+/**
+ * @file
+ * @brief Contains a lock free, multi producer multi consumer variant of the copy queue.
+ */
+#pragma once
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "cache_line.h"
+#include "error_codes.h"
+
+typedef struct MpmcCopyQueue MpmcCopyQueue_t;
+typedef struct MpmcCopyQueueConfig MpmcCopyQueueConfig_t;
+
+/**
+ * @class MpmcCopyQueueConfig
+ */
+struct MpmcCopyQueueConfig
+{
+    uint8_t * queue_buffer; /**< Buffer used to store the elements */
+    size_t queue_size; /**< the total size of the queue in bytes, should be equal to the value element_count * element_size */
+    size_t element_count; /**< The number of elements in the queue, must be a power of 2 */
+    size_t element_size; /**< The size of an element in the queue */
+    atomic_size_t * sequence_buffer; /**< One sequence number per element, used to hand slots between threads. Must have element_count items. */
+};
+
+/**
+ * @brief A bounded queue which copies values into itself, safe for any number of producer and consumer threads.
+ *
+ * Each slot carries a sequence number which tells a thread whether the slot is ready to be written (sequence equals
+ * the enqueue position) or read (sequence equals the dequeue position + 1). Threads claim a position with a single
+ * compare and swap, then copy the element without holding any lock, and publish the slot by advancing its sequence.
+ *
+ * @note Init and deinit are not thread safe, and must be called while no other thread is using the queue.
+ */
+struct MpmcCopyQueue
+{
+    uint8_t * buffer;
+    atomic_size_t * sequences;
+    size_t max_size;
+    size_t size_mask;
+    size_t element_size;
+    alignas(CEMB_CACHE_LINE_SIZE) atomic_size_t enqueue_position;
+    alignas(CEMB_CACHE_LINE_SIZE) atomic_size_t dequeue_position;
+};
+
+/**
+ * @brief Initialises a multi producer, multi consumer copy queue.
+ *
+ * @param[in] queue - the queue to use
+ * @param[in] config - the queue's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG
+ *
+ * @memberof MpmcCopyQueue
+ */
+ErrorCode_t mpmc_copy_queue_init(MpmcCopyQueue_t * queue, MpmcCopyQueueConfig_t const * config);
+
+/**
+ * @brief Deinitialises a queue.
+ *
+ * @param[in] queue - the queue to use
+ *
+ * @memberof MpmcCopyQueue
+ */
+void mpmc_copy_queue_deinit(MpmcCopyQueue_t * queue);
+
+/**
+ * @brief Places an element in the queue, note the element will be copied in.
+ *
+ * @param[in] queue - the queue to use
+ * @param[in] element - The element to copy into the queue, should be the same type as the queue was initialised.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - queue is full
+ *
+ * @memberof MpmcCopyQueue
+ */
+ErrorCode_t mpmc_copy_queue_enqueue(MpmcCopyQueue_t * queue, void const * element);
+
+/**
+ * @brief Removes the oldest element from the queue.
+ *
+ * @param[in] queue - the queue to use
+ * @param[inout] element - the location to copy the element to. Must be of the type the queue was initialised to.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - The queue has no elements
+ *
+ * @memberof MpmcCopyQueue
+ */
+ErrorCode_t mpmc_copy_queue_dequeue(MpmcCopyQueue_t * queue, void * element);
+
+/**
+ * @brief Gets the number of items in the queue.
+ *
+ * @note When called while other threads are using the queue, the result is a snapshot and may already be stale.
+ *
+ * @param[in] queue - the queue to use
+ *
+ * @returns The number of items in the queue, aka the count.
+ *
+ * @memberof MpmcCopyQueue
+ */
+size_t mpmc_copy_queue_get_size(MpmcCopyQueue_t * queue);
@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @brief A per thread cache of objects in front of a shared pool allocator.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+#include "ptr_stack.h"
+
+typedef struct PoolMagazine PoolMagazine_t;
+typedef struct PoolMagazineConfig PoolMagazineConfig_t;
+typedef struct PoolMagazineStats PoolMagazineStats_t;
+
+/**
+ * @brief Config parameters for the #PoolMagazine.
+ * @class PoolMagazineConfig
+ */
+struct PoolMagazineConfig
+{
+    IPoolAllocator_t const * backing_allocator; /**< Pool the objects come from, must be safe to call from every thread with a magazine on it, such as a #ConcurrentPool */
+    void ** object_buffer; /**< Storage for the cached object pointers, must have magazine_size items */
+    size_t magazine_size; /**< Maximum number of objects cached */
+    size_t batch_size; /**< Number of objects moved to or from the backing allocator at once, between 1 and magazine_size */
+};
+
+/**
+ * @brief Counters for sizing a #PoolMagazine.
+ *
+ * If refills or flushes are a large fraction of allocations or deallocations, the magazine is too small for the
+ * thread's working set. Larger batches reduce how often the backing allocator is used.
+ *
+ * @class PoolMagazineStats
+ */
+struct PoolMagazineStats
+{
+    size_t allocate_count; /**< Successful allocations */
+    size_t deallocate_count; /**< Successful deallocations */
+    size_t refill_count; /**< Times an empty magazine requested objects from the backing allocator */
+    size_t flush_count; /**< Times a full magazine returned objects to the backing allocator */
+};
+
+/**
+ * @brief A cache of free objects owned by a single thread.
+ *
+ * Allocations pop from and deallocations push to the thread's own magazine, so the common path touches no shared memory.
+ * An empty magazine is refilled with a batch of objects from the backing allocator, and a full magazine flushes a
+ * batch back, each batch in a single bulk call to the backing allocator. With batch_size set to half of magazine_size,
+ * the magazine is left half used after either, so a thread alternating around the boundary does not trigger a refill
+ * or flush on every call.
+ *
+ * @note A magazine is not thread safe, each thread needs its own magazine.
+ *
+ * @class PoolMagazine
+ */
+struct PoolMagazine
+{
+    IPoolAllocator_t backing_allocator;
+    PtrStack_t cache;
+    size_t batch_size;
+    PoolMagazineStats_t stats;
+};
+
+/**
+ * @brief  Gets the pool allocator interface corresponding to this magazine.
+ *
+ * @param[in] magazine - The magazine to create the interface for
+ * @param[in] interface - The interface to configure
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof PoolMagazine
+ */
+ErrorCode_t pool_magazine_as_i_pool_allocator(PoolMagazine_t * magazine, IPoolAllocator_t * interface);
+
+/**
+ * @brief  Initialises an empty magazine, objects are only taken from the backing allocator on the first allocation.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ * @param[in] config - The magazine's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The provided configuration is invalid
+ *
+ * @memberof PoolMagazine
+ */
+ErrorCode_t pool_magazine_init(PoolMagazine_t * magazine, PoolMagazineConfig_t const * config);
+
+/**
+ * @brief  Returns all cached objects to the backing allocator and de-initialises the magazine.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ *
+ * @memberof PoolMagazine
+ */
+void pool_magazine_deinit(PoolMagazine_t * magazine);
+
+/**
+ * @brief  Requests an object, refilling the magazine from the backing allocator if it is empty.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ * @param[inout] object_ptr - The pointer to the object acquired.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - The magazine and the backing allocator are empty
+ *
+ * @memberof PoolMagazine
+ */
+ErrorCode_t pool_magazine_allocate(PoolMagazine_t * magazine, void ** object_ptr);
+
+/**
+ * @brief  Frees an object into the magazine, flushing a batch to the backing allocator if the magazine is full.
+ *
+ * Objects are only validated by the backing allocator when they are flushed, so invalid pointers may not be reported
+ * by this call.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ * @param[inout] object_ptr - The object to free. The pointer provided will return to NULL after freeing.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is NULL
+ *
+ * @memberof PoolMagazine
+ */
+ErrorCode_t pool_magazine_deallocate(PoolMagazine_t * magazine, void ** object_ptr);
+
+/**
+ * @brief  Returns every cached object to the backing allocator, for example before the owning thread exits.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ *
+ * @memberof PoolMagazine
+ */
+void pool_magazine_flush(PoolMagazine_t * magazine);
+
+/**
+ * @brief  Gets the number of objects that can be allocated, from the magazine and the backing allocator.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ *
+ * @returns The number of unused objects available to this magazine
+ *
+ * @memberof PoolMagazine
+ */
+size_t pool_magazine_get_available_count(PoolMagazine_t * magazine);
+
+/**
+ * @brief  Gets the number of objects cached in the magazine.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ *
+ * @returns The number of objects that can be allocated without using the backing allocator
+ *
+ * @memberof PoolMagazine
+ */
+size_t pool_magazine_get_cached_count(PoolMagazine_t * magazine);
+
+/**
+ * @brief  Gets the magazine's counters.
+ *
+ * @param[in] magazine - The pointer to the magazine
+ * @param[out] stats - Set to the counters since init
+ *
+ * @memberof PoolMagazine
+ */
+void pool_magazine_get_stats(PoolMagazine_t const * magazine, PoolMagazineStats_t * stats);
@@ -80,3 +80,31 @@ ErrorCode_t ptr_stack_push(PtrStack_t * stack, void * value);
  * @memberof PtrStack
  */
 ErrorCode_t ptr_stack_pop(PtrStack_t * stack, void ** value);
+
+/**
+ * @brief  Pushes a run of values onto the stack, either all of them or none.
+ * 
+ * @param[in] stack - The pointer to the stack
+ * @param[in] values - The pointers to push, the last is on top afterwards
+ * @param[in] count - Number of values to push
+ * 
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - Stack does not have room for every value
+ * 
+ * @memberof PtrStack
+ */
+ErrorCode_t ptr_stack_push_bulk(PtrStack_t * stack, void * const * values, size_t count);
+
+/**
+ * @brief  Pops a run of values from the stack, either all of them or none.
+ * 
+ * @param[in] stack - The pointer to the stack
+ * @param[out] values - Set to the values popped, in the order they were pushed
+ * @param[in] count - Number of values to pop
+ * 
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - Stack has fewer than count values
+ * 
+ * @memberof PtrStack
+ */
+ErrorCode_t ptr_stack_pop_bulk(PtrStack_t * stack, void ** values, size_t count);
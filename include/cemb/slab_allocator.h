@@ -0,0 +1,169 @@
+/**
+ * @file
+ * @brief An allocator serving several object sizes, each from its own static pool carved out of a single buffer.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+#include "static_pool.h"
+
+/**
+ * @brief Object sizes must be a multiple of this, and the lookup table has one entry per multiple.
+ */
+#define SLAB_ALLOCATOR_SIZE_GRANULARITY (8)
+
+/**
+ * @brief Each size class region starts at a multiple of this offset in the buffer.
+ */
+#define SLAB_ALLOCATOR_REGION_ALIGNMENT (sizeof(max_align_t))
+
+/**
+ * @brief Number of lookup table entries needed for the largest object size.
+ */
+#define SLAB_ALLOCATOR_LOOKUP_TABLE_SIZE(max_object_size) \
+    ((((max_object_size) + SLAB_ALLOCATOR_SIZE_GRANULARITY - 1) / SLAB_ALLOCATOR_SIZE_GRANULARITY) + 1)
+
+/**
+ * @brief Maximum number of size classes, so a class index fits in a lookup table entry.
+ */
+#define SLAB_ALLOCATOR_MAX_SIZE_CLASSES (UINT8_MAX)
+
+typedef struct SlabAllocator SlabAllocator_t;
+typedef struct SlabAllocatorConfig SlabAllocatorConfig_t;
+typedef struct SlabSizeClassConfig SlabSizeClassConfig_t;
+
+/**
+ * @brief Config parameters for a single size class of a #SlabAllocator.
+ * @class SlabSizeClassConfig
+ */
+struct SlabSizeClassConfig
+{
+    size_t object_size; /**< Size of each object in bytes, must be a multiple of #SLAB_ALLOCATOR_SIZE_GRANULARITY */
+    size_t object_count; /**< Number of objects in this class */
+    void ** allocation_stack; /**< Allocation stack with object_count items, or NULL to use the intrusive free list of #StaticPool */
+};
+
+/**
+ * @brief Config parameters for the #SlabAllocator.
+ * @class SlabAllocatorConfig
+ */
+struct SlabAllocatorConfig
+{
+    uint8_t * buffer; /**< Buffer the size class regions are carved from */
+    size_t buffer_size; /**< Size of the buffer in bytes, must fit every region, each aligned to #SLAB_ALLOCATOR_REGION_ALIGNMENT */
+    SlabSizeClassConfig_t const * size_classes; /**< Size classes in strictly ascending object_size order */
+    StaticPool_t * pools; /**< One pool per size class */
+    size_t size_class_count; /**< Number of size classes, up to #SLAB_ALLOCATOR_MAX_SIZE_CLASSES */
+    uint8_t * lookup_table; /**< Size to class table, must have SLAB_ALLOCATOR_LOOKUP_TABLE_SIZE(largest object_size) items */
+    size_t lookup_table_size; /**< Number of items in the lookup table */
+};
+
+/**
+ * @brief An allocator serving objects of several sizes from a single static buffer.
+ *
+ * Each size class is a #StaticPool over its own region of the buffer. A requested size is rounded up to the size
+ * granularity and used to index a lookup table, which holds the smallest class that fits, so choosing the class does
+ * not depend on the number of classes. If that class is exhausted, the next larger class with a free object is used.
+ *
+ * Deallocation finds the owning class by checking which region the pointer falls in.
+ *
+ * @class SlabAllocator
+ */
+struct SlabAllocator
+{
+    StaticPool_t * pools;
+    size_t size_class_count;
+    uint8_t const * lookup_table;
+    size_t max_object_size;
+};
+
+/**
+ * @brief  Gets the pool allocator interface corresponding to this allocator.
+ *
+ * The interface's allocate serves objects of the largest size class, use allocate_sized to request a size.
+ *
+ * @param[in] slab - The allocator to create the interface for
+ * @param[in] interface - The interface to configure
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof SlabAllocator
+ */
+ErrorCode_t slab_allocator_as_i_pool_allocator(SlabAllocator_t * slab, IPoolAllocator_t * interface);
+
+/**
+ * @brief  Initialises a slab allocator, carving the buffer into one region per size class.
+ *
+ * @param[in] slab - The pointer to the allocator
+ * @param[in] config - The allocator's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The provided configuration is invalid
+ *
+ * @memberof SlabAllocator
+ */
+ErrorCode_t slab_allocator_init(SlabAllocator_t * slab, SlabAllocatorConfig_t const * config);
+
+/**
+ * @brief  De-initialises a slab allocator and all of its pools.
+ *
+ * @param[in] slab - The pointer to the allocator
+ *
+ * @memberof SlabAllocator
+ */
+void slab_allocator_deinit(SlabAllocator_t * slab);
+
+/**
+ * @brief  Requests an object of at least the given size.
+ *
+ * @param[in] slab - The pointer to the allocator
+ * @param[in] size - The minimum size of the object in bytes
+ * @param[inout] object_ptr - The pointer to the object acquired.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - No class large enough has a free object
+ * @retval #ERR_INVALID_ARG - The size is larger than the largest size class
+ *
+ * @memberof SlabAllocator
+ */
+ErrorCode_t slab_allocator_allocate_sized(SlabAllocator_t * slab, size_t size, void ** object_ptr);
+
+/**
+ * @brief  Requests an object of the largest size class.
+ *
+ * @param[in] slab - The pointer to the allocator
+ * @param[inout] object_ptr - The pointer to the object acquired.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - The largest class has no free objects
+ *
+ * @memberof SlabAllocator
+ */
+ErrorCode_t slab_allocator_allocate(SlabAllocator_t * slab, void ** object_ptr);
+
+/**
+ * @brief  Frees an object back to the size class it came from.
+ *
+ * @param[in] slab - The pointer to the allocator
+ * @param[inout] object_ptr - The object to free. The pointer provided will return to NULL after freeing.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is NULL or not within any size class region
+ *
+ * @memberof SlabAllocator
+ */
+ErrorCode_t slab_allocator_deallocate(SlabAllocator_t * slab, void ** object_ptr);
+
+/**
+ * @brief  Gets the number of free objects across all size classes.
+ *
+ * @param[in] slab - The pointer to the allocator
+ *
+ * @returns The number of unused objects
+ *
+ * @memberof SlabAllocator
+ */
+size_t slab_allocator_get_available_count(SlabAllocator_t * slab);
@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @brief Contains a lock free single producer, single consumer variant of the fast circular buffer.
+ */
+#pragma once
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "cache_line.h"
+#include "error_codes.h"
+#include "fast_circular_buffer.h"
+
+typedef struct SpscFastCircularBuffer SpscFastCircularBuffer_t;
+
+/**
+ * @brief Lock free circular buffer for exactly one producer thread and one consumer thread.
+ *
+ * Uses the same power of 2 sized #FastCircularBufferConfig as #FastCircularBuffer. The write index is only modified by
+ * the producer and the read index only by the consumer, each is published with release ordering and observed with
+ * acquire ordering. Each side keeps a cached copy of the other side's index so the shared index (and its cache line)
+ * is only read when the cached value suggests the buffer is full or empty.
+ *
+ * Unlike #FastCircularBuffer, a full buffer rejects new bytes instead of overriding the oldest, as the producer cannot
+ * safely move the read index.
+ *
+ * @note Init and deinit are not thread safe, and must be called while neither side is running.
+ */
+struct SpscFastCircularBuffer
+{
+    uint8_t * buffer;
+    size_t size_mask;
+    alignas(CEMB_CACHE_LINE_SIZE) atomic_size_t write_index; /**< Owned by the producer. */
+    size_t cached_read_index; /**< Producer's last observed read index. */
+    alignas(CEMB_CACHE_LINE_SIZE) atomic_size_t read_index; /**< Owned by the consumer. */
+    size_t cached_write_index; /**< Consumer's last observed write index. */
+};
+
+/**
+ * @brief Initialises a single producer, single consumer circular byte buffer.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[in] buffer_config - the configuration parameters
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG
+ *
+ * @memberof SpscFastCircularBuffer
+ */
+ErrorCode_t spsc_fast_circular_buffer_init(SpscFastCircularBuffer_t * buffer, FastCircularBufferConfig_t const * buffer_config);
+
+/**
+ * @brief Deinitialises the circular byte buffer to a safe state.
+ *
+ * @param[in] buffer - the circular buffer
+ *
+ * @memberof SpscFastCircularBuffer
+ */
+void spsc_fast_circular_buffer_deinit(SpscFastCircularBuffer_t * buffer);
+
+/**
+ * @brief Pushes a value onto the circular buffer. Producer only.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[in] byte - the byte to push
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - buffer is full (or has been deinitialised)
+ *
+ * @memberof SpscFastCircularBuffer
+ */
+ErrorCode_t spsc_fast_circular_buffer_push_byte(SpscFastCircularBuffer_t * buffer, uint8_t byte);
+
+/**
+ * @brief Pops a value from the circular buffer. Consumer only.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[inout] byte - the pointer to the location to store the popped byte
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - buffer is empty
+ *
+ * @memberof SpscFastCircularBuffer
+ */
+ErrorCode_t spsc_fast_circular_buffer_pop_byte(SpscFastCircularBuffer_t * buffer, uint8_t * byte);
+
+/**
+ * @brief Pushes as many bytes of a block as there is space for, publishing them all at once. Producer only.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[in] bytes - the bytes to push, can be NULL if length is 0
+ * @param[in] length - number of bytes to push
+ *
+ * @returns Number of bytes pushed, which is less than length if the buffer did not have enough space.
+ *
+ * @memberof SpscFastCircularBuffer
+ */
+size_t spsc_fast_circular_buffer_push(SpscFastCircularBuffer_t * buffer, uint8_t const * bytes, size_t length);
+
+/**
+ * @brief Pops up to length bytes from the circular buffer. Consumer only.
+ *
+ * @param[in] buffer - the circular buffer
+ * @param[inout] bytes - the location to store the popped bytes, must fit at least length bytes
+ * @param[in] length - maximum number of bytes to pop
+ *
+ * @returns Number of bytes popped, which is less than length if the buffer did not have enough bytes.
+ *
+ * @memberof SpscFastCircularBuffer
+ */
+size_t spsc_fast_circular_buffer_pop(SpscFastCircularBuffer_t * buffer, uint8_t * bytes, size_t length);
+
+/**
+ * @brief Gets the number of items within the buffer.
+ *
+ * @note When called while the other side is running, the result is a snapshot and may already be stale.
+ *
+ * @param[in] buffer - the circular buffer
+ *
+ * @returns Number of items in the buffer
+ *
+ * @memberof SpscFastCircularBuffer
+ */
+size_t spsc_fast_circular_buffer_get_count(SpscFastCircularBuffer_t * buffer);
@@ -9,10 +9,28 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "cache_line.h"
 #include "i_pool_allocator.h"
 #include "error_codes.h"
 #include "ptr_stack.h"
 
+/**
+ * @brief Gets the distance between objects of object_size bytes, each starting on an alignment boundary.
+ */
+#define STATIC_POOL_STRIDE(object_size, alignment) ((((object_size) + (alignment) - 1) / (alignment)) * (alignment))
+
+/**
+ * @brief Gets the buffer size needed for object_count objects aligned to alignment, for a buffer of any alignment.
+ */
+#define STATIC_POOL_BUFFER_SIZE(object_size, object_count, alignment)                                                  \
+    ((STATIC_POOL_STRIDE(object_size, alignment) * (object_count)) + (alignment) - 1)
+
+/**
+ * @brief Gets the buffer size needed for object_count objects that each sit on their own cache lines.
+ */
+#define STATIC_POOL_CACHE_LINE_BUFFER_SIZE(object_size, object_count)                                                  \
+    STATIC_POOL_BUFFER_SIZE(object_size, object_count, CEMB_CACHE_LINE_SIZE)
+
 typedef struct StaticPool StaticPool_t;
 typedef struct StaticPoolConfig StaticPoolConfig_t;
 
@@ -22,11 +40,13 @@ typedef struct StaticPoolConfig StaticPoolConfig_t;
  */
 struct StaticPoolConfig
 {
-    void ** allocation_stack; /**< An allocation stack needed to for keeping track of the free spaces, should have object_size items. */
+    void ** allocation_stack; /**< An allocation stack needed to for keeping track of the free spaces, should have object_size items. Set to NULL to thread the free list through the free objects instead, see #StaticPool. */
     uint8_t * buffer; /**< The size of the buffer to manage */
     size_t buffer_size; /**< Size of the buffer in bytes, note the object size must be an integer multiple of the object size. */
     size_t object_size; /**< Size of each object in bytes. */
     size_t object_count; /**< Number of objects this pool manages. Note that (object_size * object_count == buffer_size) */
+    size_t alignment; /**< Alignment of each object in bytes, a power of 2. Set to 0 to place objects from the start of the buffer. */
+    size_t stride; /**< Distance between objects in bytes, a multiple of alignment and at least object_size. Set to 0 to use object_size rounded up to the alignment. */
 };
 
 /**
@@ -34,13 +54,26 @@ struct StaticPoolConfig
  * 
  * Each block in this pool has the same size, and is designed for allowing for "dynamic" like memory use in a static 
  * only style environment. Useful for allocating and freeing some run time data if needed.
+ *
+ * When the config has no allocation stack, the pool runs in intrusive mode. The free list is stored in the first
+ * pointer sized bytes of each free object, so object_size must be at least sizeof(void *). Objects that have never been
+ * allocated are handed out from a bump index rather than being pushed at init, so init does not touch the buffer.
+ *
+ * Objects are placed stride bytes apart from the first alignment boundary in the buffer. Aligning to
+ * #CEMB_CACHE_LINE_SIZE keeps objects used by different threads off each other's cache lines, use
+ * #STATIC_POOL_CACHE_LINE_BUFFER_SIZE to size the buffer for this.
  * 
  * @class StaticPool
  */
 struct StaticPool
 {
     StaticPoolConfig_t config;
+    uint8_t * objects; /**< First object, the buffer rounded up to the alignment. */
+    size_t stride; /**< Distance between objects in bytes. */
     PtrStack_t free_stack;
+    void * free_list; /**< Most recently freed object in intrusive mode, each free object holds the next one. */
+    size_t bump_index; /**< Index of the first object never handed out in intrusive mode. */
+    size_t available_count; /**< Number of unused objects in intrusive mode. */
 };
 
 /**
@@ -61,7 +94,9 @@ ErrorCode_t static_pool_as_i_pool_allocator(StaticPool_t * pool, IPoolAllocator_
  * @param[in] pool - The pointer to the static pool object
  * 
  * @retval #ERR_NONE
- * @retval #ERR_INVALID_ARG - The provided configuration is invalid
+ * @retval #ERR_INVALID_ARG - The provided configuration is invalid, or in intrusive mode the objects are too small to
+ *                            hold a pointer. The buffer must hold object_count strides after its first alignment
+ *                            boundary.
  * 
  * @memberof StaticPool
  */
@@ -98,12 +133,47 @@ ErrorCode_t static_pool_allocate(StaticPool_t * pool, void ** object_ptr);
  * @param[inout] object_ptr - The object to free back into the pool. The pointer provided will return to NULL after freeing. Note the object provided should be
  * 
  * @retval #ERR_NONE
- * @retval #ERR_OUT_OF_BOUNDS - The token provided is out of bounds.
+ * @retval #ERR_OUT_OF_BOUNDS - The token provided is out of bounds. In intrusive mode, this is also returned for
+ *                              pointers outside of the buffer, or if every object is already free.
  * 
  * @memberof StaticPool
  */
 ErrorCode_t static_pool_deallocate(StaticPool_t * pool, void ** object_ptr);
 
+/**
+ * @brief  Requests a number of objects from the pool, either all of them or none.
+ *
+ * With an allocation stack, the objects are copied from the top of the stack in one step.
+ *
+ * @param[in] pool - The pointer to the static pool object
+ * @param[out] object_ptrs - Set to the objects acquired, must have count items.
+ * @param[in] count - Number of objects to acquire.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - Fewer than count slots are available, no objects were allocated
+ *
+ * @memberof StaticPool
+ */
+ErrorCode_t static_pool_allocate_bulk(StaticPool_t * pool, void ** object_ptrs, size_t count);
+
+/**
+ * @brief  Frees a number of objects back into the pool. Every pointer provided will return to NULL after freeing.
+ *
+ * With an allocation stack, the objects are copied onto the top of the stack in one step. If any pointer is NULL or the
+ * stack cannot hold them all, or in intrusive mode, each object is checked and freed on its own instead, so the valid
+ * objects are still freed and the first error is returned.
+ *
+ * @param[in] pool - The pointer to the static pool object
+ * @param[inout] object_ptrs - The objects to free, must have count items.
+ * @param[in] count - Number of objects to free.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - A token provided is out of bounds, as for #static_pool_deallocate.
+ *
+ * @memberof StaticPool
+ */
+ErrorCode_t static_pool_deallocate_bulk(StaticPool_t * pool, void ** object_ptrs, size_t count);
+
 /**
  * @brief  Gets the number of remaining slots in the pool.
  * 
@@ -0,0 +1,188 @@
+/**
+ * @file
+ * @brief A Two-Level Segregated Fit allocator for variable sized allocations from a static buffer.
+ *
+ * Does not take into account threaded operations, as this allocator does not lock.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+#include "i_pool_allocator.h"
+
+/**
+ * @brief Alignment of every allocation, and of the buffer provided to the allocator.
+ */
+#define TLSF_ALLOCATOR_ALIGN_SIZE (8)
+
+/**
+ * @brief Log2 of the number of second level lists per first level size range.
+ */
+#define TLSF_ALLOCATOR_SL_INDEX_COUNT_LOG2 (4)
+
+/**
+ * @brief Log2 of the block size limit, the buffer must be smaller than this.
+ */
+#define TLSF_ALLOCATOR_FL_INDEX_MAX (30)
+
+#define TLSF_ALLOCATOR_SL_INDEX_COUNT (1 << TLSF_ALLOCATOR_SL_INDEX_COUNT_LOG2)
+#define TLSF_ALLOCATOR_FL_INDEX_SHIFT (TLSF_ALLOCATOR_SL_INDEX_COUNT_LOG2 + 3)
+#define TLSF_ALLOCATOR_FL_INDEX_COUNT (TLSF_ALLOCATOR_FL_INDEX_MAX - TLSF_ALLOCATOR_FL_INDEX_SHIFT + 1)
+
+typedef struct TlsfAllocator TlsfAllocator_t;
+typedef struct TlsfAllocatorConfig TlsfAllocatorConfig_t;
+typedef struct TlsfAllocatorStats TlsfAllocatorStats_t;
+typedef struct TlsfBlock TlsfBlock_t;
+
+/**
+ * @brief Config parameters for the #TlsfAllocator.
+ * @class TlsfAllocatorConfig
+ */
+struct TlsfAllocatorConfig
+{
+    uint8_t * buffer; /**< Buffer to allocate from, must be aligned to #TLSF_ALLOCATOR_ALIGN_SIZE */
+    size_t buffer_size; /**< Size of the buffer in bytes, less than 2^#TLSF_ALLOCATOR_FL_INDEX_MAX */
+    size_t default_size; /**< Size in bytes of objects requested through the interface's unsized allocate, 0 if only sized requests are made */
+};
+
+/**
+ * @brief Usage and fragmentation of a #TlsfAllocator.
+ * @class TlsfAllocatorStats
+ */
+struct TlsfAllocatorStats
+{
+    size_t free_bytes; /**< Bytes in free blocks */
+    size_t used_bytes; /**< Bytes in allocated blocks, including the rounding of each request */
+    size_t largest_free_block; /**< Largest single allocation that can currently succeed */
+    size_t free_block_count; /**< Number of free blocks */
+    size_t used_block_count; /**< Number of allocated blocks */
+    uint32_t fragmentation_percent; /**< Percentage of free bytes outside of the largest free block, 0 when all free space is contiguous */
+};
+
+/**
+ * @brief A block header, each block is preceded in the buffer by its header.
+ *
+ * The previous physical block pointer is stored at the end of the previous block, so it is only valid while the
+ * previous block is free. The free list pointers are stored in the block's own payload, so they are only valid while
+ * the block is free. An allocated block therefore only costs the size word, padded to #TLSF_ALLOCATOR_ALIGN_SIZE.
+ */
+struct TlsfBlock
+{
+    TlsfBlock_t * prev_physical;
+    size_t size; /**< Payload size in bytes, the lowest bits hold the free flags of this and the previous block */
+    TlsfBlock_t * next_free;
+    TlsfBlock_t * prev_free;
+};
+
+/**
+ * @brief A variable size allocator over a static buffer, where allocate and deallocate take bounded time.
+ *
+ * Free blocks are kept in segregated lists. The first level splits sizes by power of 2 and the second level splits
+ * each power of 2 range linearly. A bitmap per level records which lists have blocks. Finding a block is two
+ * find-first-set operations regardless of how many blocks exist, and blocks are rounded up to the next list so any
+ * block found is large enough. Freed blocks are merged with free neighbours straight away, which bounds fragmentation.
+ *
+ * @class TlsfAllocator
+ */
+struct TlsfAllocator
+{
+    uint8_t * buffer;
+    size_t buffer_size;
+    size_t free_bytes;
+    size_t default_size;
+    uint32_t fl_bitmap;
+    uint32_t sl_bitmap[TLSF_ALLOCATOR_FL_INDEX_COUNT];
+    TlsfBlock_t * free_lists[TLSF_ALLOCATOR_FL_INDEX_COUNT][TLSF_ALLOCATOR_SL_INDEX_COUNT];
+};
+
+/**
+ * @brief  Gets the pool allocator interface corresponding to this allocator.
+ *
+ * The unsized allocate requests the configured default size, so the allocator can back wrappers that only allocate
+ * unsized, such as a #PoolMagazine. Without a default size it returns #ERR_NOT_IMPLEMENTED. The available count is the
+ * number of free bytes.
+ *
+ * @param[in] tlsf - The allocator to create the interface for
+ * @param[in] interface - The interface to configure
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof TlsfAllocator
+ */
+ErrorCode_t tlsf_allocator_as_i_pool_allocator(TlsfAllocator_t * tlsf, IPoolAllocator_t * interface);
+
+/**
+ * @brief  Initialises the allocator with the whole buffer as a single free block.
+ *
+ * @param[in] tlsf - The pointer to the allocator
+ * @param[in] config - The allocator's configuration
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - The buffer is misaligned, too small to hold a block, or too large
+ *
+ * @memberof TlsfAllocator
+ */
+ErrorCode_t tlsf_allocator_init(TlsfAllocator_t * tlsf, TlsfAllocatorConfig_t const * config);
+
+/**
+ * @brief  De-initialises the allocator.
+ *
+ * @param[in] tlsf - The pointer to the allocator
+ *
+ * @memberof TlsfAllocator
+ */
+void tlsf_allocator_deinit(TlsfAllocator_t * tlsf);
+
+/**
+ * @brief  Allocates at least size bytes, aligned to #TLSF_ALLOCATOR_ALIGN_SIZE.
+ *
+ * @param[in] tlsf - The pointer to the allocator
+ * @param[in] size - Number of bytes requested
+ * @param[inout] object_ptr - The pointer to the allocation
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - No free block is large enough
+ * @retval #ERR_INVALID_ARG - The size is 0, or larger than the allocator supports
+ *
+ * @memberof TlsfAllocator
+ */
+ErrorCode_t tlsf_allocator_allocate(TlsfAllocator_t * tlsf, size_t size, void ** object_ptr);
+
+/**
+ * @brief  Frees an allocation, merging it with any free neighbouring blocks.
+ *
+ * @param[in] tlsf - The pointer to the allocator
+ * @param[inout] object_ptr - The allocation to free. The pointer provided will return to NULL after freeing.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is NULL or outside of the buffer
+ * @retval #ERR_INVALID_STATE - The block is already free
+ *
+ * @memberof TlsfAllocator
+ */
+ErrorCode_t tlsf_allocator_deallocate(TlsfAllocator_t * tlsf, void ** object_ptr);
+
+/**
+ * @brief  Gets the number of bytes in free blocks.
+ *
+ * @param[in] tlsf - The pointer to the allocator
+ *
+ * @returns The free bytes, a single allocation may be limited to less than this by fragmentation
+ *
+ * @memberof TlsfAllocator
+ */
+size_t tlsf_allocator_get_free_bytes(TlsfAllocator_t * tlsf);
+
+/**
+ * @brief  Walks every block to collect usage and fragmentation statistics.
+ *
+ * @note This takes time proportional to the number of blocks, so is intended for monitoring rather than real time paths.
+ *
+ * @param[in] tlsf - The pointer to the allocator
+ * @param[out] stats - Set to the current statistics
+ *
+ * @memberof TlsfAllocator
+ */
+void tlsf_allocator_get_stats(TlsfAllocator_t const * tlsf, TlsfAllocatorStats_t * stats);
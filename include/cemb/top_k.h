@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @brief Streaming selection of the K highest ranked items, built on #BoundedHeap.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "bounded_heap.h"
+#include "error_codes.h"
+
+typedef struct TopKConfig TopKConfig_t;
+typedef struct TopK TopK_t;
+
+/**
+ * @brief Configuration values for a #TopK
+ */
+struct TopKConfig
+{
+    void ** heap_storage; /**< Underlying buffer to store the kept items, must have k items. */
+    size_t k; /**< The number of items to keep. */
+    BoundedHeapCompareFunc_t ranks_above; /**< Returns true if the first item ranks above the second. */
+};
+
+/**
+ * @brief Keeps the K highest ranked of a stream of items.
+ *
+ * The kept items are held in a heap with the lowest ranked at the root. Once K items are kept, an offered item only
+ * needs a single compare against the root to be rejected, so the common case of a long stream costs O(1) per item.
+ * An item that does rank above the root replaces it with one sift, in O(log K).
+ *
+ * @note As with #BoundedHeap, only pointers to the items are kept, ownership stays with the user.
+ */
+struct TopK
+{
+    BoundedHeap_t heap;
+};
+
+/**
+ * @brief  Inits the selector for use
+ *
+ * @param[in] top_k - pointer to the selector instance
+ * @param[in] config - the config to set the selector
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_INVALID_ARG - k is 0.
+ *
+ * @memberof TopK
+ */
+ErrorCode_t top_k_init(TopK_t * top_k, TopKConfig_t const * config);
+
+/**
+ * @brief  Deinitialises the selector.
+ *
+ * @param[in] top_k - pointer to the selector instance
+ *
+ * @memberof TopK
+ */
+void top_k_deinit(TopK_t * top_k);
+
+/**
+ * @brief Offers an item, which is kept if it ranks among the K highest seen so far.
+ *
+ * Items that tie with the lowest kept item are rejected, so earlier items win ties.
+ *
+ * @param[in] top_k - pointer to the selector instance
+ * @param[in] item - The item to offer, can be a NULL
+ * @param[out] dropped_item - Set to the item no longer kept: the item offered if it was rejected, the lowest kept item
+ *                            if it was evicted, or NULL if nothing was dropped. Can be NULL.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_NO_MEM - The selector has been de-initialised, the item was not kept
+ *
+ * @memberof TopK
+ */
+ErrorCode_t top_k_offer(TopK_t * top_k, void * item, void ** dropped_item);
+
+/**
+ * @brief Gets the lowest ranked item kept, which an offered item must rank above once K items are kept.
+ *
+ * @param[in] top_k - pointer to the selector instance
+ * @param[out] item - Set to the lowest ranked item kept.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_EMPTY - No items are kept
+ *
+ * @memberof TopK
+ */
+ErrorCode_t top_k_get_threshold(TopK_t * top_k, void ** item);
+
+/**
+ * @brief Moves the kept items out, highest ranked first, leaving the selector empty for the next stream.
+ *
+ * @param[in] top_k - pointer to the selector instance
+ * @param[out] items - Set to the kept items in rank order, must have room for k items.
+ * @param[out] count - Set to the number of items written.
+ *
+ * @retval #ERR_NONE
+ *
+ * @memberof TopK
+ */
+ErrorCode_t top_k_emit_sorted(TopK_t * top_k, void ** items, size_t * count);
+
+/**
+ * @brief  Gets the number of items kept.
+ *
+ * @returns The number of items kept, at most k.
+ *
+ * @memberof TopK
+ */
+size_t top_k_get_size(TopK_t const * top_k);
@@ -0,0 +1,148 @@
+/**
+ * @file
+ * @brief Generator for bounded heaps specialised to a key type, payload type and capacity at compile time.
+ *
+ * #BoundedHeap stores pointers and orders them through a compare function pointer, so every sift step is an indirect
+ * call that chases two pointers. This generator produces a heap whose keys are stored by value in a contiguous array
+ * embedded in the struct, with the comparison expanded inline, so sifting only walks the key array. Payloads are kept
+ * in a parallel array and are only moved alongside their keys.
+ *
+ * The ordering is given as an expression of the keys a and b, which is true if a belongs nearer the root than b.
+ * Example, which defines TimerHeap_t along with timer_heap_init(), timer_heap_push(), etc as a min heap on deadlines:
+ * ```
+ * CEMB_DEFINE_BOUNDED_HEAP(TimerHeap, timer_heap, uint32_t, Timer_t *, 64, (a) < (b))
+ * ```
+ *
+ * The generated API mirrors #BoundedHeap, and can be placed in a header to share a heap type between files.
+ */
+#pragma once
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+
+/**
+ * @brief Defines a bounded heap type and its functions.
+ *
+ * @param struct_name - Name of the heap struct, the typedef will be struct_name##_t
+ * @param function_prefix - Prefix of the generated functions
+ * @param key_type - Type of the keys the heap is ordered by, must be assignable
+ * @param payload_type - Type of the value stored with each key, must be assignable
+ * @param capacity - Number of entries the heap holds, must be a constant greater than 0
+ * @param less_expr - Expression of the keys a and b, true if a should be popped before b
+ */
+#define CEMB_DEFINE_BOUNDED_HEAP(struct_name, function_prefix, key_type, payload_type, capacity, less_expr)             \
+    _Static_assert((capacity) > 0, "bounded heap capacity must be greater than 0");                                     \
+                                                                                                                        \
+    typedef struct struct_name struct_name##_t;                                                                         \
+                                                                                                                        \
+    struct struct_name                                                                                                  \
+    {                                                                                                                   \
+        size_t count;                                                                                                   \
+        size_t max_size;                                                                                                \
+        key_type keys[(capacity)];                                                                                      \
+        payload_type payloads[(capacity)];                                                                              \
+    };                                                                                                                  \
+                                                                                                                        \
+    static inline bool function_prefix##_less(key_type const a, key_type const b)                                       \
+    {                                                                                                                   \
+        return (less_expr);                                                                                             \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline void function_prefix##_init(struct_name##_t * heap)                                                   \
+    {                                                                                                                   \
+        assert(heap);                                                                                                   \
+                                                                                                                        \
+        heap->count = 0;                                                                                                \
+        heap->max_size = (capacity);                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline void function_prefix##_deinit(struct_name##_t * heap)                                                 \
+    {                                                                                                                   \
+        assert(heap);                                                                                                   \
+                                                                                                                        \
+        heap->count = 0;                                                                                                \
+        heap->max_size = 0;                                                                                             \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline size_t function_prefix##_get_remaining(struct_name##_t const * heap)                                  \
+    {                                                                                                                   \
+        assert(heap);                                                                                                   \
+                                                                                                                        \
+        return heap->max_size - heap->count;                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline size_t function_prefix##_get_size(struct_name##_t const * heap)                                       \
+    {                                                                                                                   \
+        assert(heap);                                                                                                   \
+                                                                                                                        \
+        return heap->count;                                                                                             \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline ErrorCode_t function_prefix##_push(struct_name##_t * heap, key_type key, payload_type payload)        \
+    {                                                                                                                   \
+        assert(heap);                                                                                                   \
+                                                                                                                        \
+        if (function_prefix##_get_remaining(heap) == 0) return ERR_NO_MEM;                                              \
+                                                                                                                        \
+        /* parents are moved down into the hole until the new key fits, rather than swapping at each level */          \
+        size_t child_idx = heap->count++;                                                                               \
+        while (child_idx > 0)                                                                                           \
+        {                                                                                                               \
+            size_t parent_idx = (child_idx - 1) / 2;                                                                    \
+            if (!function_prefix##_less(key, heap->keys[parent_idx])) break;                                            \
+            heap->keys[child_idx] = heap->keys[parent_idx];                                                             \
+            heap->payloads[child_idx] = heap->payloads[parent_idx];                                                     \
+            child_idx = parent_idx;                                                                                     \
+        }                                                                                                               \
+        heap->keys[child_idx] = key;                                                                                    \
+        heap->payloads[child_idx] = payload;                                                                            \
+        return ERR_NONE;                                                                                                \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline ErrorCode_t function_prefix##_peek(struct_name##_t const * heap, key_type * key,                      \
+                                                     payload_type * payload)                                            \
+    {                                                                                                                   \
+        assert(heap);                                                                                                   \
+        assert(key);                                                                                                    \
+        assert(payload);                                                                                                \
+                                                                                                                        \
+        if (function_prefix##_get_size(heap) == 0) return ERR_EMPTY;                                                    \
+        *key = heap->keys[0];                                                                                           \
+        *payload = heap->payloads[0];                                                                                   \
+        return ERR_NONE;                                                                                                \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline ErrorCode_t function_prefix##_pop(struct_name##_t * heap, key_type * key, payload_type * payload)     \
+    {                                                                                                                   \
+        assert(heap);                                                                                                   \
+        assert(key);                                                                                                    \
+        assert(payload);                                                                                                \
+                                                                                                                        \
+        if (function_prefix##_get_size(heap) == 0) return ERR_EMPTY;                                                    \
+        *key = heap->keys[0];                                                                                           \
+        *payload = heap->payloads[0];                                                                                   \
+                                                                                                                        \
+        /* the last entry is sifted down from the root, children are moved up into the hole as it goes */               \
+        size_t count = --heap->count;                                                                                   \
+        key_type last_key = heap->keys[count];                                                                          \
+        size_t parent_idx = 0;                                                                                          \
+        size_t child_idx = 1;                                                                                           \
+        while (child_idx < count)                                                                                       \
+        {                                                                                                               \
+            if ((child_idx + 1 < count) && function_prefix##_less(heap->keys[child_idx + 1], heap->keys[child_idx]))    \
+            {                                                                                                           \
+                child_idx++;                                                                                            \
+            }                                                                                                           \
+            if (!function_prefix##_less(heap->keys[child_idx], last_key)) break;                                        \
+            heap->keys[parent_idx] = heap->keys[child_idx];                                                             \
+            heap->payloads[parent_idx] = heap->payloads[child_idx];                                                     \
+            parent_idx = child_idx;                                                                                     \
+            child_idx = (2 * parent_idx) + 1;                                                                           \
+        }                                                                                                               \
+        heap->keys[parent_idx] = last_key;                                                                              \
+        heap->payloads[parent_idx] = heap->payloads[count];                                                             \
+        return ERR_NONE;                                                                                                \
+    }
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @brief Generator for copy queues specialised to a single element type and capacity at compile time.
+ *
+ * #CopyQueue copies elements with a runtime element size, which prevents the copy from being inlined. This generator
+ * produces a queue whose storage is embedded in the struct and whose functions are static inline, so each copy is a
+ * plain assignment of the element type that the compiler can fully inline.
+ *
+ * Example, which defines MessageQueue_t along with message_queue_init(), message_queue_enqueue(), etc:
+ * ```
+ * CEMB_DEFINE_COPY_QUEUE(MessageQueue, message_queue, Message_t, 32)
+ * ```
+ *
+ * The generated API mirrors #CopyQueue, and can be placed in a header to share a queue type between files.
+ */
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "error_codes.h"
+
+/**
+ * @brief Defines a copy queue type and its functions.
+ *
+ * @param struct_name - Name of the queue struct, the typedef will be struct_name##_t
+ * @param function_prefix - Prefix of the generated functions
+ * @param element_type - Type of each element, must be assignable
+ * @param capacity - Number of elements the queue holds, must be a constant greater than 0
+ */
+#define CEMB_DEFINE_COPY_QUEUE(struct_name, function_prefix, element_type, capacity)                                    \
+    _Static_assert((capacity) > 0, "copy queue capacity must be greater than 0");                                       \
+                                                                                                                        \
+    typedef struct struct_name struct_name##_t;                                                                         \
+                                                                                                                        \
+    struct struct_name                                                                                                  \
+    {                                                                                                                   \
+        size_t count;                                                                                                   \
+        size_t max_size;                                                                                                \
+        size_t tail_idx;                                                                                                \
+        size_t head_idx;                                                                                                \
+        element_type elements[(capacity)];                                                                              \
+    };                                                                                                                  \
+                                                                                                                        \
+    static inline void function_prefix##_init(struct_name##_t * queue)                                                  \
+    {                                                                                                                   \
+        assert(queue);                                                                                                  \
+                                                                                                                        \
+        queue->count = 0;                                                                                               \
+        queue->max_size = (capacity);                                                                                   \
+        queue->tail_idx = 0;                                                                                            \
+        queue->head_idx = 0;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline void function_prefix##_deinit(struct_name##_t * queue)                                                \
+    {                                                                                                                   \
+        assert(queue);                                                                                                  \
+                                                                                                                        \
+        queue->count = 0;                                                                                               \
+        queue->max_size = 0;                                                                                            \
+        queue->tail_idx = 0;                                                                                            \
+        queue->head_idx = 0;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline size_t function_prefix##_get_remaining(struct_name##_t const * queue)                                 \
+    {                                                                                                                   \
+        assert(queue);                                                                                                  \
+                                                                                                                        \
+        return queue->max_size - queue->count;                                                                          \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline size_t function_prefix##_get_size(struct_name##_t const * queue)                                      \
+    {                                                                                                                   \
+        assert(queue);                                                                                                  \
+                                                                                                                        \
+        return queue->count;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline ErrorCode_t function_prefix##_enqueue(struct_name##_t * queue, element_type const * element)          \
+    {                                                                                                                   \
+        assert(queue);                                                                                                  \
+        assert(element);                                                                                                \
+                                                                                                                        \
+        if (function_prefix##_get_remaining(queue) == 0) return ERR_NO_MEM;                                             \
+        queue->elements[queue->tail_idx] = *element;                                                                    \
+        queue->tail_idx = (queue->tail_idx + 1 == (capacity)) ? 0 : queue->tail_idx + 1;                                \
+        queue->count++;                                                                                                 \
+        return ERR_NONE;                                                                                                \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline ErrorCode_t function_prefix##_dequeue(struct_name##_t * queue, element_type * element)                \
+    {                                                                                                                   \
+        assert(queue);                                                                                                  \
+        assert(element);                                                                                                \
+                                                                                                                        \
+        if (function_prefix##_get_size(queue) == 0) return ERR_EMPTY;                                                   \
+        *element = queue->elements[queue->head_idx];                                                                    \
+        queue->head_idx = (queue->head_idx + 1 == (capacity)) ? 0 : queue->head_idx + 1;                                \
+        queue->count--;                                                                                                 \
+        return ERR_NONE;                                                                                                \
+    }                                                                                                                   \
+                                                                                                                        \
+    static inline ErrorCode_t function_prefix##_peek(struct_name##_t const * queue, element_type * element)             \
+    {                                                                                                                   \
+        assert(queue);                                                                                                  \
+        assert(element);                                                                                                \
+                                                                                                                        \
+        if (function_prefix##_get_size(queue) == 0) return ERR_EMPTY;                                                   \
+        *element = queue->elements[queue->head_idx];                                                                    \
+        return ERR_NONE;                                                                                                \
+    }
@@ -0,0 +1,208 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <cemb/blocking_copy_queue.h>
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <time.h>
+
+/**
+ * @brief Gets the absolute monotonic time the wait should end, the condition variables use the monotonic clock so
+ * changes to the wall clock do not affect timeouts.
+ */
+static struct timespec blocking_copy_queue_get_deadline(uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return deadline;
+}
+
+/**
+ * @brief Waits on the condition, with the lock held.
+ *
+ * @retval #ERR_NONE - woken, the caller must check its condition again
+ * @retval #ERR_TIMEOUT - deadline passed
+ */
+static ErrorCode_t blocking_copy_queue_wait(BlockingCopyQueue_t * queue, pthread_cond_t * condition, size_t * waiters,
+                                            uint32_t timeout_ms, struct timespec const * deadline)
+{
+    int result;
+
+    if (timeout_ms == 0) return ERR_TIMEOUT;
+
+    (*waiters)++;
+    if (timeout_ms == BLOCKING_COPY_QUEUE_WAIT_FOREVER)
+    {
+        result = pthread_cond_wait(condition, &queue->lock);
+    }
+    else
+    {
+        result = pthread_cond_timedwait(condition, &queue->lock, deadline);
+    }
+    (*waiters)--;
+
+    return (result == ETIMEDOUT) ? ERR_TIMEOUT : ERR_NONE;
+}
+
+/**
+ * @brief Wakes a single waiter, only if there is one.
+ */
+static void blocking_copy_queue_wake(BlockingCopyQueue_t * queue, pthread_cond_t * condition, size_t waiters)
+{
+    if (waiters == 0) return;
+    queue->wake_count++;
+    pthread_cond_signal(condition);
+}
+
+ErrorCode_t blocking_copy_queue_init(BlockingCopyQueue_t * queue, CopyQueueConfig_t const * config)
+{
+    assert(queue);
+    assert(config);
+
+    ErrorCode_t ret = copy_queue_init(&queue->queue, config);
+    if (ret != ERR_NONE) return ret;
+
+    pthread_condattr_t condition_attributes;
+    if (pthread_condattr_init(&condition_attributes) != 0) return ERR_NO_MEM;
+    pthread_condattr_setclock(&condition_attributes, CLOCK_MONOTONIC);
+
+    ret = ERR_NO_MEM;
+    if (pthread_mutex_init(&queue->lock, NULL) == 0)
+    {
+        if (pthread_cond_init(&queue->not_empty, &condition_attributes) == 0)
+        {
+            if (pthread_cond_init(&queue->not_full, &condition_attributes) == 0)
+            {
+                ret = ERR_NONE;
+            }
+            else
+            {
+                pthread_cond_destroy(&queue->not_empty);
+                pthread_mutex_destroy(&queue->lock);
+            }
+        }
+        else
+        {
+            pthread_mutex_destroy(&queue->lock);
+        }
+    }
+    pthread_condattr_destroy(&condition_attributes);
+
+    queue->waiting_consumers = 0;
+    queue->waiting_producers = 0;
+    queue->wake_count = 0;
+
+    if (ret != ERR_NONE) copy_queue_deinit(&queue->queue);
+    return ret;
+}
+
+void blocking_copy_queue_deinit(BlockingCopyQueue_t * queue)
+{
+    assert(queue);
+
+    pthread_cond_destroy(&queue->not_full);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_mutex_destroy(&queue->lock);
+    copy_queue_deinit(&queue->queue);
+    queue->waiting_consumers = 0;
+    queue->waiting_producers = 0;
+    queue->wake_count = 0;
+}
+
+ErrorCode_t blocking_copy_queue_enqueue_timed(BlockingCopyQueue_t * queue, void const * element, uint32_t timeout_ms)
+{
+    assert(queue);
+    assert(element);
+
+    struct timespec deadline = blocking_copy_queue_get_deadline(timeout_ms);
+    ErrorCode_t ret = ERR_NONE;
+
+    pthread_mutex_lock(&queue->lock);
+
+    while (copy_queue_get_remaining(&queue->queue) == 0)
+    {
+        ret = blocking_copy_queue_wait(queue, &queue->not_full, &queue->waiting_producers, timeout_ms, &deadline);
+        if ((ret == ERR_TIMEOUT) && (copy_queue_get_remaining(&queue->queue) == 0)) break;
+        ret = ERR_NONE;
+    }
+
+    if (ret == ERR_NONE)
+    {
+        bool was_empty = (copy_queue_get_size(&queue->queue) == 0);
+        copy_queue_enqueue(&queue->queue, element);
+
+        // consumers only sleep on an empty queue, so only the first element of a burst needs to wake one
+        if (was_empty) blocking_copy_queue_wake(queue, &queue->not_empty, queue->waiting_consumers);
+
+        // a producer woken for space passes the wake on if space remains for another waiting producer
+        if (copy_queue_get_remaining(&queue->queue) > 0)
+        {
+            blocking_copy_queue_wake(queue, &queue->not_full, queue->waiting_producers);
+        }
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+    return ret;
+}
+
+ErrorCode_t blocking_copy_queue_dequeue_timed(BlockingCopyQueue_t * queue, void * element, uint32_t timeout_ms)
+{
+    assert(queue);
+    assert(element);
+
+    struct timespec deadline = blocking_copy_queue_get_deadline(timeout_ms);
+    ErrorCode_t ret = ERR_NONE;
+
+    pthread_mutex_lock(&queue->lock);
+
+    while (copy_queue_get_size(&queue->queue) == 0)
+    {
+        ret = blocking_copy_queue_wait(queue, &queue->not_empty, &queue->waiting_consumers, timeout_ms, &deadline);
+        if ((ret == ERR_TIMEOUT) && (copy_queue_get_size(&queue->queue) == 0)) break;
+        ret = ERR_NONE;
+    }
+
+    if (ret == ERR_NONE)
+    {
+        bool was_full = (copy_queue_get_remaining(&queue->queue) == 0);
+        copy_queue_dequeue(&queue->queue, element);
+
+        if (was_full) blocking_copy_queue_wake(queue, &queue->not_full, queue->waiting_producers);
+
+        if (copy_queue_get_size(&queue->queue) > 0)
+        {
+            blocking_copy_queue_wake(queue, &queue->not_empty, queue->waiting_consumers);
+        }
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+    return ret;
+}
+
+size_t blocking_copy_queue_get_size(BlockingCopyQueue_t * queue)
+{
+    assert(queue);
+
+    pthread_mutex_lock(&queue->lock);
+    size_t size = copy_queue_get_size(&queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return size;
+}
+
+size_t blocking_copy_queue_get_wake_count(BlockingCopyQueue_t * queue)
+{
+    assert(queue);
+
+    pthread_mutex_lock(&queue->lock);
+    size_t wake_count = queue->wake_count;
+    pthread_mutex_unlock(&queue->lock);
+    return wake_count;
+}
@@ -7,40 +7,86 @@ static ErrorCode_t bounded_heap_validate_config(BoundedHeapConfig_t const * conf
     assert(config->heap_storage);
     assert(config->compare);
     if (config->element_count == 0) return ERR_INVALID_ARG;
+    if ((config->arity == 1) || ((config->arity & (config->arity - 1)) != 0)) return ERR_INVALID_ARG;
     return ERR_NONE;
 }
 
+static size_t bounded_heap_get_arity_shift(BoundedHeapConfig_t const * config)
+{
+    size_t arity_shift = 1;
+    while ((config->arity >> arity_shift) > 1) arity_shift++;
+    return arity_shift;
+}
+
 static size_t bounded_heap_get_next_empty_index(BoundedHeap_t * heap)
 {
     /* A heap's left most empty position is determined purely by the number of items in the heap. */
     return heap->items_in_heap;
 }
 
-static size_t bounded_heap_get_index_of_parent(size_t index)
+static size_t bounded_heap_get_index_of_parent(BoundedHeap_t const * heap, size_t index)
 {
-    return (index-1)/2;
+    return (index-1) >> heap->arity_shift;
 }
 
-static size_t bounded_heap_get_index_of_left_child(size_t index)
+static size_t bounded_heap_get_index_of_first_child(BoundedHeap_t const * heap, size_t index)
 {
-    return (2*index)+1;
+    return (index << heap->arity_shift)+1;
 }
 
-static size_t bounded_heap_get_index_of_right_child(size_t index)
+static void * bounded_heap_get_value_at(BoundedHeap_t * heap, size_t index)
 {
-    return (2*index)+2;
+    return heap->config.heap_storage[index];
 }
 
-static void bounded_heap_swap_values_at_index(BoundedHeap_t * heap, size_t index_a, size_t index_b)
+/**
+ * @brief Places an item at index and moves it down, the child that belongs highest moves up into the hole at each level.
+ */
+static void bounded_heap_sift_down(BoundedHeap_t * heap, size_t parent_idx, void * item)
 {
-    void * tmp = heap->config.heap_storage[index_a];
-    heap->config.heap_storage[index_a] = heap->config.heap_storage[index_b];
-    heap->config.heap_storage[index_b] = tmp;
+    size_t heap_size = bounded_heap_get_size(heap);
+
+    while (true)
+    {
+        size_t first_child_idx = bounded_heap_get_index_of_first_child(heap, parent_idx);
+        if (first_child_idx >= heap_size) break;
+
+        size_t end_child_idx = first_child_idx + ((size_t)1 << heap->arity_shift);
+        if (end_child_idx > heap_size) end_child_idx = heap_size;
+
+        size_t best_child_idx = first_child_idx;
+        for (size_t child_idx = first_child_idx + 1; child_idx < end_child_idx; ++child_idx)
+        {
+            if (heap->config.compare(bounded_heap_get_value_at(heap, best_child_idx),
+                                     bounded_heap_get_value_at(heap, child_idx)))
+            {
+                best_child_idx = child_idx;
+            }
+        }
+
+        if (!heap->config.compare(item, bounded_heap_get_value_at(heap, best_child_idx))) break;
+
+        heap->config.heap_storage[parent_idx] = bounded_heap_get_value_at(heap, best_child_idx);
+        parent_idx = best_child_idx;
+    }
+    heap->config.heap_storage[parent_idx] = item;
 }
 
-static void * bounded_heap_get_value_at(BoundedHeap_t * heap, size_t index)
+/**
+ * @brief Places an item at index and moves it up, parents that should sit below the item move down into the hole.
+ */
+static void bounded_heap_sift_up(BoundedHeap_t * heap, size_t child_idx, void * item)
 {
-    return heap->config.heap_storage[index];
+    while (child_idx > 0)
+    {
+        size_t parent_idx = bounded_heap_get_index_of_parent(heap, child_idx);
+
+        if (!heap->config.compare(bounded_heap_get_value_at(heap, parent_idx), item)) break;
+
+        heap->config.heap_storage[child_idx] = bounded_heap_get_value_at(heap, parent_idx);
+        child_idx = parent_idx;
+    }
+    heap->config.heap_storage[child_idx] = item;
 }
 
 ErrorCode_t bounded_heap_init(BoundedHeap_t * heap, BoundedHeapConfig_t const * config)
@@ -52,6 +98,7 @@ ErrorCode_t bounded_heap_init(BoundedHeap_t * heap, BoundedHeapConfig_t const *
     if (ret != ERR_NONE) return ret;
 
     heap->config = *config;
+    heap->arity_shift = bounded_heap_get_arity_shift(config);
     heap->heap_max_size = config->element_count;
     heap->items_in_heap = 0;
     return ret;
@@ -86,56 +133,8 @@ ErrorCode_t bounded_heap_pop(BoundedHeap_t * heap, void ** heap_item)
     *heap_item = heap->config.heap_storage[0];
     heap->items_in_heap--;
 
-    // swap the first value and the end of the heap
-    bounded_heap_swap_values_at_index(heap, 0, bounded_heap_get_next_empty_index(heap));
-
-    // now we heapify
-    size_t parent_idx = 0;
-
-    bool done = false;
-    while (!done)
-    {
-        size_t left_child_idx = bounded_heap_get_index_of_left_child(parent_idx);
-        size_t right_child_idx = bounded_heap_get_index_of_right_child(parent_idx);
-
-        if ((left_child_idx >= bounded_heap_get_size(heap)) || (right_child_idx >= bounded_heap_get_size(heap))) break;
-
-        bool left_child_swap = heap->config.compare(bounded_heap_get_value_at(heap, parent_idx),
-                                                      bounded_heap_get_value_at(heap, left_child_idx));
-        bool right_child_swap = heap->config.compare(bounded_heap_get_value_at(heap, parent_idx),
-                                                       bounded_heap_get_value_at(heap, right_child_idx));
-
-        if (left_child_swap && right_child_swap)
-        {
-            /** 
-             * Swap Arbitration
-             * If both need to be swapped we just check what happens if we swap with the left. If we swap with the left
-             * (left = parent) and we check with the right child idx and a swap still needs to be done, we can just swap
-             * the original parent with the right to save a swap
-             */
-            
-            bool swap_with_right = heap->config.compare(bounded_heap_get_value_at(heap, left_child_idx),
-                                                          bounded_heap_get_value_at(heap, right_child_idx));
-            left_child_swap = !swap_with_right;
-            right_child_swap = swap_with_right;
-        }
-        
-        if (left_child_swap)
-        {
-            bounded_heap_swap_values_at_index(heap, parent_idx, left_child_idx);
-            parent_idx = left_child_idx;
-        }
-        else if (right_child_swap)
-        {
-            bounded_heap_swap_values_at_index(heap, parent_idx, right_child_idx);
-            parent_idx = right_child_idx;
-        }
-        else
-        {
-            // do swaps needed, we are done
-            done = true;
-        }
-    }
+    // the last item is sifted down from the root
+    bounded_heap_sift_down(heap, 0, bounded_heap_get_value_at(heap, bounded_heap_get_next_empty_index(heap)));
 
     return ERR_NONE;
 }
@@ -147,32 +146,67 @@ ErrorCode_t bounded_heap_push(BoundedHeap_t * heap, void * heap_item)
     if (bounded_heap_get_remaining(heap) == 0) return ERR_NO_MEM;
     
     size_t child_idx = bounded_heap_get_next_empty_index(heap);
-
-    heap->config.heap_storage[child_idx] = heap_item;
     heap->items_in_heap++;
 
-    // now we bubble up, we dont have to do anything if we only have 1 item;
+    // now we bubble up from the first empty spot
+    bounded_heap_sift_up(heap, child_idx, heap_item);
+    
+    return ERR_NONE;
+}
 
-    bool done = (bounded_heap_get_size(heap) == 1);
+ErrorCode_t bounded_heap_build(BoundedHeap_t * heap, void * const * heap_items, size_t count)
+{
+    assert(heap);
+    assert(heap_items || (count == 0));
 
-    while (!done)
+    if (bounded_heap_get_remaining(heap) < count) return ERR_NO_MEM;
+    if (count == 0) return ERR_NONE;
+
+    for (size_t idx = 0; idx < count; ++idx)
     {
-        if (child_idx == 0) break;
-        
-        size_t parent_idx = bounded_heap_get_index_of_parent(child_idx);
+        heap->config.heap_storage[heap->items_in_heap + idx] = heap_items[idx];
+    }
+    heap->items_in_heap += count;
 
-        if (heap->config.compare(bounded_heap_get_value_at(heap, parent_idx),
-                                   bounded_heap_get_value_at(heap, child_idx)))
-        {
-            bounded_heap_swap_values_at_index(heap, parent_idx, child_idx);
-            child_idx = parent_idx;
-        }
-        else
-        {
-            done = true;
-        }
+    if (bounded_heap_get_size(heap) == 1) return ERR_NONE;
+
+    // bottom up, every parent is sifted into the already valid heaps below it, leaves need no work
+    size_t parent_idx = bounded_heap_get_index_of_parent(heap, bounded_heap_get_size(heap) - 1) + 1;
+    while (parent_idx > 0)
+    {
+        parent_idx--;
+        bounded_heap_sift_down(heap, parent_idx, bounded_heap_get_value_at(heap, parent_idx));
     }
-    
+    return ERR_NONE;
+}
+
+ErrorCode_t bounded_heap_pushpop(BoundedHeap_t * heap, void * heap_item, void ** popped_item)
+{
+    assert(heap);
+    assert(popped_item);
+
+    // an item that belongs above the root would be popped straight back out, so the heap is left alone
+    if ((bounded_heap_get_size(heap) == 0) ||
+        heap->config.compare(bounded_heap_get_value_at(heap, 0), heap_item))
+    {
+        *popped_item = heap_item;
+        return ERR_NONE;
+    }
+
+    *popped_item = bounded_heap_get_value_at(heap, 0);
+    bounded_heap_sift_down(heap, 0, heap_item);
+    return ERR_NONE;
+}
+
+ErrorCode_t bounded_heap_replace_top(BoundedHeap_t * heap, void * heap_item, void ** popped_item)
+{
+    assert(heap);
+    assert(popped_item);
+
+    if (bounded_heap_get_size(heap) == 0) return ERR_EMPTY;
+
+    *popped_item = bounded_heap_get_value_at(heap, 0);
+    bounded_heap_sift_down(heap, 0, heap_item);
     return ERR_NONE;
 }
 
@@ -1,6 +1,7 @@
 #include <cemb/circular_buffer.h>
 
 #include <assert.h>
+#include <string.h>
 
 ErrorCode_t circular_buffer_validate_config(CircularBufferConfig_t const * config)
 {
@@ -10,6 +11,27 @@ ErrorCode_t circular_buffer_validate_config(CircularBufferConfig_t const * confi
     return ERR_NONE;
 }
 
+/**
+ * @brief Advances an index by an offset, the offset must not exceed the buffer size so at most one wrap is needed.
+ */
+static size_t circular_buffer_advance_index(CircularBuffer_t const * buffer, size_t index, size_t offset)
+{
+    index += offset;
+    return (index >= buffer->buffer_max_size) ? (index - buffer->buffer_max_size) : index;
+}
+
+/**
+ * @brief Copies bytes starting from the read index, without changing the buffer state.
+ */
+static void circular_buffer_copy_out(CircularBuffer_t const * buffer, uint8_t * bytes, size_t length)
+{
+    size_t first_length = buffer->buffer_max_size - buffer->read_index;
+    if (first_length > length) first_length = length;
+
+    memcpy(bytes, &buffer->buffer[buffer->read_index], first_length);
+    memcpy(&bytes[first_length], buffer->buffer, length - first_length);
+}
+
 ErrorCode_t circular_buffer_init(CircularBuffer_t * buffer, CircularBufferConfig_t const * config)
 {
     assert(buffer);
@@ -45,10 +67,10 @@ ErrorCode_t circular_buffer_push_byte(CircularBuffer_t * buffer, uint8_t byte)
     
     if ((buffer->write_index == buffer->read_index) && !buffer->buffer_is_empty)
     {
-        buffer->read_index = (buffer->read_index + 1) % buffer->buffer_max_size;
+        buffer->read_index = circular_buffer_advance_index(buffer, buffer->read_index, 1);
     }
 
-    buffer->write_index = (buffer->write_index + 1) % buffer->buffer_max_size;
+    buffer->write_index = circular_buffer_advance_index(buffer, buffer->write_index, 1);
     buffer->buffer_is_empty = false;
 
     return ERR_NONE;
@@ -62,12 +84,76 @@ ErrorCode_t circular_buffer_pop_byte(CircularBuffer_t * buffer, uint8_t * byte)
     if (circular_buffer_get_count(buffer) == 0) return ERR_EMPTY;
 
     *byte = buffer->buffer[buffer->read_index];
-    buffer->read_index = (buffer->read_index + 1) % buffer->buffer_max_size;
+    buffer->read_index = circular_buffer_advance_index(buffer, buffer->read_index, 1);
     buffer->buffer_is_empty = (buffer->read_index == buffer->write_index);
 
     return ERR_NONE;
 }
 
+ErrorCode_t circular_buffer_push(CircularBuffer_t * buffer, uint8_t const * bytes, size_t length)
+{
+    assert(buffer);
+    assert(bytes || (length == 0));
+
+    if (buffer->buffer_max_size == 0) return ERR_NO_MEM;
+    if (length == 0) return ERR_NONE;
+
+    // only the newest bytes survive a block larger than the buffer
+    if (length > buffer->buffer_max_size)
+    {
+        bytes += length - buffer->buffer_max_size;
+        length = buffer->buffer_max_size;
+    }
+
+    bool is_overriding = (circular_buffer_get_count(buffer) + length) > buffer->buffer_max_size;
+
+    size_t first_length = buffer->buffer_max_size - buffer->write_index;
+    if (first_length > length) first_length = length;
+
+    memcpy(&buffer->buffer[buffer->write_index], bytes, first_length);
+    memcpy(buffer->buffer, &bytes[first_length], length - first_length);
+
+    buffer->write_index = circular_buffer_advance_index(buffer, buffer->write_index, length);
+    if (is_overriding)
+    {
+        // the buffer is now full, so the oldest byte sits where the next write will occur
+        buffer->read_index = buffer->write_index;
+    }
+    buffer->buffer_is_empty = false;
+
+    return ERR_NONE;
+}
+
+size_t circular_buffer_pop(CircularBuffer_t * buffer, uint8_t * bytes, size_t length)
+{
+    assert(buffer);
+    assert(bytes || (length == 0));
+
+    size_t count = circular_buffer_get_count(buffer);
+    if (length > count) length = count;
+    if (length == 0) return 0;
+
+    circular_buffer_copy_out(buffer, bytes, length);
+    buffer->read_index = circular_buffer_advance_index(buffer, buffer->read_index, length);
+    buffer->buffer_is_empty = (length == count);
+
+    return length;
+}
+
+size_t circular_buffer_peek(CircularBuffer_t const * buffer, uint8_t * bytes, size_t length)
+{
+    assert(buffer);
+    assert(bytes || (length == 0));
+
+    size_t count = circular_buffer_get_count(buffer);
+    if (length > count) length = count;
+    if (length == 0) return 0;
+
+    circular_buffer_copy_out(buffer, bytes, length);
+
+    return length;
+}
+
 size_t circular_buffer_get_count(CircularBuffer_t const * buffer)
 {
     assert(buffer);
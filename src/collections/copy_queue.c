@@ -14,6 +14,15 @@ static ErrorCode_t copy_queue_validate_config(CopyQueueConfig_t const * config)
     return ERR_NONE;
 }
 
+/**
+ * @brief Advances a byte offset into the ring, the step must not exceed the ring size so at most one wrap is needed.
+ */
+static size_t copy_queue_advance_index(CopyQueue_t const * queue, size_t index, size_t step)
+{
+    index += step;
+    return (index >= queue->buffer_size) ? (index - queue->buffer_size) : index;
+}
+
 ErrorCode_t copy_queue_init(CopyQueue_t * queue, CopyQueueConfig_t const * config)
 {
     assert(queue);
@@ -25,6 +34,7 @@ ErrorCode_t copy_queue_init(CopyQueue_t * queue, CopyQueueConfig_t const * confi
     queue->buffer = config->queue_buffer;
     queue->element_size = config->element_size;
     queue->max_size = config->element_count;
+    queue->buffer_size = config->element_count * config->element_size;
     queue->count = 0;
     queue->tail_idx = 0;
     queue->head_idx = 0;
@@ -39,6 +49,7 @@ void copy_queue_deinit(CopyQueue_t * queue)
     queue->buffer = NULL; 
     queue->element_size = 0;
     queue->max_size = 0;
+    queue->buffer_size = 0;
     queue->count = 0;
     queue->tail_idx = 0;
     queue->head_idx = 0;
@@ -51,7 +62,7 @@ ErrorCode_t copy_queue_enqueue(CopyQueue_t * queue, void const * element)
     
     if (copy_queue_get_remaining(queue) == 0) return ERR_NO_MEM;
     memcpy((void *)&queue->buffer[queue->tail_idx], element, queue->element_size);
-    queue->tail_idx += queue->element_size;
+    queue->tail_idx = copy_queue_advance_index(queue, queue->tail_idx, queue->element_size);
     queue->count++;
     return ERR_NONE;
 }
@@ -63,11 +74,93 @@ ErrorCode_t copy_queue_dequeue(CopyQueue_t * queue, void * element)
 
     if (copy_queue_get_size(queue) == 0) return ERR_EMPTY;
     memcpy(element, (void *)&queue->buffer[queue->head_idx], queue->element_size);
-    queue->head_idx += queue->element_size;
+    queue->head_idx = copy_queue_advance_index(queue, queue->head_idx, queue->element_size);
     queue->count--;
     return ERR_NONE;
 }
 
+ErrorCode_t copy_queue_reserve(CopyQueue_t * queue, void ** slot)
+{
+    assert(queue);
+    assert(slot);
+
+    if (copy_queue_get_remaining(queue) == 0) return ERR_NO_MEM;
+    *slot = (void *)&queue->buffer[queue->tail_idx];
+    return ERR_NONE;
+}
+
+ErrorCode_t copy_queue_commit(CopyQueue_t * queue)
+{
+    assert(queue);
+
+    if (copy_queue_get_remaining(queue) == 0) return ERR_NO_MEM;
+    queue->tail_idx = copy_queue_advance_index(queue, queue->tail_idx, queue->element_size);
+    queue->count++;
+    return ERR_NONE;
+}
+
+ErrorCode_t copy_queue_front(CopyQueue_t * queue, void ** slot)
+{
+    assert(queue);
+    assert(slot);
+
+    if (copy_queue_get_size(queue) == 0) return ERR_EMPTY;
+    *slot = (void *)&queue->buffer[queue->head_idx];
+    return ERR_NONE;
+}
+
+ErrorCode_t copy_queue_release(CopyQueue_t * queue)
+{
+    assert(queue);
+
+    if (copy_queue_get_size(queue) == 0) return ERR_EMPTY;
+    queue->head_idx = copy_queue_advance_index(queue, queue->head_idx, queue->element_size);
+    queue->count--;
+    return ERR_NONE;
+}
+
+size_t copy_queue_enqueue_n(CopyQueue_t * queue, void const * elements, size_t element_count)
+{
+    assert(queue);
+    assert(elements || (element_count == 0));
+
+    size_t remaining = copy_queue_get_remaining(queue);
+    if (element_count > remaining) element_count = remaining;
+    if (element_count == 0) return 0;
+
+    uint8_t const * bytes = elements;
+    size_t length = element_count * queue->element_size;
+    size_t first_length = queue->buffer_size - queue->tail_idx;
+    if (first_length > length) first_length = length;
+
+    memcpy(&queue->buffer[queue->tail_idx], bytes, first_length);
+    memcpy(queue->buffer, &bytes[first_length], length - first_length);
+    queue->tail_idx = copy_queue_advance_index(queue, queue->tail_idx, length);
+    queue->count += element_count;
+    return element_count;
+}
+
+size_t copy_queue_dequeue_n(CopyQueue_t * queue, void * elements, size_t element_count)
+{
+    assert(queue);
+    assert(elements || (element_count == 0));
+
+    size_t size = copy_queue_get_size(queue);
+    if (element_count > size) element_count = size;
+    if (element_count == 0) return 0;
+
+    uint8_t * bytes = elements;
+    size_t length = element_count * queue->element_size;
+    size_t first_length = queue->buffer_size - queue->head_idx;
+    if (first_length > length) first_length = length;
+
+    memcpy(bytes, &queue->buffer[queue->head_idx], first_length);
+    memcpy(&bytes[first_length], queue->buffer, length - first_length);
+    queue->head_idx = copy_queue_advance_index(queue, queue->head_idx, length);
+    queue->count -= element_count;
+    return element_count;
+}
+
 ErrorCode_t copy_queue_peek(CopyQueue_t * queue, void * element)
 {
     assert(queue);
@@ -65,6 +65,64 @@ ErrorCode_t fast_circular_buffer_pop_byte(FastCircularBuffer_t * buffer, uint8_t
     return ERR_NONE;
 }
 
+ErrorCode_t fast_circular_buffer_reserve_write(FastCircularBuffer_t * buffer, uint8_t ** region, size_t * region_length)
+{
+    assert(buffer);
+    assert(region);
+    assert(region_length);
+
+    if (buffer->size_mask == 0) return ERR_NO_MEM;
+
+    size_t capacity = buffer->size_mask + 1;
+    size_t free_count = capacity - fast_circular_buffer_get_count(buffer);
+    if (free_count == 0) return ERR_NO_MEM;
+
+    size_t write_offset = buffer->write_index & buffer->size_mask;
+    size_t contiguous_count = capacity - write_offset;
+
+    *region = &buffer->buffer[write_offset];
+    *region_length = (free_count < contiguous_count) ? free_count : contiguous_count;
+    return ERR_NONE;
+}
+
+ErrorCode_t fast_circular_buffer_commit_write(FastCircularBuffer_t * buffer, size_t length)
+{
+    assert(buffer);
+
+    size_t free_count = (buffer->size_mask + 1) - fast_circular_buffer_get_count(buffer);
+    if ((buffer->size_mask == 0) || (length > free_count)) return ERR_INVALID_ARG;
+
+    buffer->write_index += length;
+    return ERR_NONE;
+}
+
+ErrorCode_t fast_circular_buffer_acquire_read(FastCircularBuffer_t * buffer, uint8_t const ** region, size_t * region_length)
+{
+    assert(buffer);
+    assert(region);
+    assert(region_length);
+
+    size_t count = fast_circular_buffer_get_count(buffer);
+    if (count == 0) return ERR_EMPTY;
+
+    size_t read_offset = buffer->read_index & buffer->size_mask;
+    size_t contiguous_count = (buffer->size_mask + 1) - read_offset;
+
+    *region = &buffer->buffer[read_offset];
+    *region_length = (count < contiguous_count) ? count : contiguous_count;
+    return ERR_NONE;
+}
+
+ErrorCode_t fast_circular_buffer_release_read(FastCircularBuffer_t * buffer, size_t length)
+{
+    assert(buffer);
+
+    if (length > fast_circular_buffer_get_count(buffer)) return ERR_INVALID_ARG;
+
+    buffer->read_index += length;
+    return ERR_NONE;
+}
+
 size_t fast_circular_buffer_get_count(FastCircularBuffer_t const * buffer)
 {
     assert(buffer);
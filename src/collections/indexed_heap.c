@@ -0,0 +1,192 @@
+#include <cemb/indexed_heap.h>
+
+#include <assert.h>
+
+static ErrorCode_t indexed_heap_validate_config(IndexedHeapConfig_t const * config)
+{
+    assert(config->heap_storage);
+    assert(config->position_storage);
+    assert(config->compare);
+    if (config->element_count == 0) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+static bool indexed_heap_is_in_heap(IndexedHeap_t const * heap, IndexedHeapHandle_t handle)
+{
+    // free handles sit past the end of the heap, which also covers every handle after a deinit
+    return (handle < heap->heap_max_size) && (heap->config.position_storage[handle] < heap->items_in_heap);
+}
+
+static void indexed_heap_place_entry(IndexedHeap_t * heap, size_t index, IndexedHeapEntry_t entry)
+{
+    heap->config.heap_storage[index] = entry;
+    heap->config.position_storage[entry.handle] = index;
+}
+
+/**
+ * @brief Moves an entry up from index, parents that belong below it move down into the hole.
+ *
+ * @returns The index the entry was placed at.
+ */
+static size_t indexed_heap_sift_up(IndexedHeap_t * heap, size_t index, IndexedHeapEntry_t entry)
+{
+    while (index > 0)
+    {
+        size_t parent_idx = (index - 1) / 2;
+        if (!heap->config.compare(heap->config.heap_storage[parent_idx].item, entry.item)) break;
+
+        indexed_heap_place_entry(heap, index, heap->config.heap_storage[parent_idx]);
+        index = parent_idx;
+    }
+    indexed_heap_place_entry(heap, index, entry);
+    return index;
+}
+
+/**
+ * @brief Moves an entry down from index, the child that belongs highest moves up into the hole.
+ */
+static void indexed_heap_sift_down(IndexedHeap_t * heap, size_t index, IndexedHeapEntry_t entry)
+{
+    while (true)
+    {
+        size_t child_idx = (2 * index) + 1;
+        if (child_idx >= heap->items_in_heap) break;
+
+        if (((child_idx + 1) < heap->items_in_heap) &&
+            heap->config.compare(heap->config.heap_storage[child_idx].item,
+                                 heap->config.heap_storage[child_idx + 1].item))
+        {
+            child_idx++;
+        }
+        if (!heap->config.compare(entry.item, heap->config.heap_storage[child_idx].item)) break;
+
+        indexed_heap_place_entry(heap, index, heap->config.heap_storage[child_idx]);
+        index = child_idx;
+    }
+    indexed_heap_place_entry(heap, index, entry);
+}
+
+/**
+ * @brief Takes the entry at index out of the heap, filling the gap with the last entry, and frees its handle.
+ */
+static void indexed_heap_remove_at(IndexedHeap_t * heap, size_t index)
+{
+    IndexedHeapHandle_t handle = heap->config.heap_storage[index].handle;
+
+    heap->items_in_heap--;
+    IndexedHeapEntry_t last = heap->config.heap_storage[heap->items_in_heap];
+
+    if (index != heap->items_in_heap)
+    {
+        // the last entry may belong above or below the gap
+        if (indexed_heap_sift_up(heap, index, last) == index) indexed_heap_sift_down(heap, index, last);
+    }
+
+    heap->config.heap_storage[heap->items_in_heap].handle = handle;
+    heap->config.position_storage[handle] = heap->items_in_heap;
+}
+
+ErrorCode_t indexed_heap_init(IndexedHeap_t * heap, IndexedHeapConfig_t const * config)
+{
+    assert(heap);
+    assert(config);
+
+    ErrorCode_t ret = indexed_heap_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    heap->config = *config;
+    heap->heap_max_size = config->element_count;
+    heap->items_in_heap = 0;
+
+    for (size_t idx = 0; idx < heap->heap_max_size; ++idx)
+    {
+        heap->config.heap_storage[idx].item = NULL;
+        heap->config.heap_storage[idx].handle = idx;
+        heap->config.position_storage[idx] = idx;
+    }
+    return ERR_NONE;
+}
+
+void indexed_heap_deinit(IndexedHeap_t * heap)
+{
+    assert(heap);
+
+    heap->items_in_heap = 0;
+    heap->heap_max_size = 0;
+}
+
+ErrorCode_t indexed_heap_push(IndexedHeap_t * heap, void * heap_item, IndexedHeapHandle_t * handle)
+{
+    assert(heap);
+
+    if (indexed_heap_get_remaining(heap) == 0) return ERR_NO_MEM;
+
+    IndexedHeapEntry_t entry = {heap_item, heap->config.heap_storage[heap->items_in_heap].handle};
+    heap->items_in_heap++;
+    indexed_heap_sift_up(heap, heap->items_in_heap - 1, entry);
+
+    if (handle != NULL) *handle = entry.handle;
+    return ERR_NONE;
+}
+
+ErrorCode_t indexed_heap_peek(IndexedHeap_t const * heap, void ** heap_item, IndexedHeapHandle_t * handle)
+{
+    assert(heap);
+    assert(heap_item);
+
+    if (indexed_heap_get_size(heap) == 0) return ERR_EMPTY;
+
+    *heap_item = heap->config.heap_storage[0].item;
+    if (handle != NULL) *handle = heap->config.heap_storage[0].handle;
+    return ERR_NONE;
+}
+
+ErrorCode_t indexed_heap_pop(IndexedHeap_t * heap, void ** heap_item)
+{
+    assert(heap);
+    assert(heap_item);
+
+    if (indexed_heap_get_size(heap) == 0) return ERR_EMPTY;
+
+    *heap_item = heap->config.heap_storage[0].item;
+    indexed_heap_remove_at(heap, 0);
+    return ERR_NONE;
+}
+
+ErrorCode_t indexed_heap_update_key(IndexedHeap_t * heap, IndexedHeapHandle_t handle, void * heap_item)
+{
+    assert(heap);
+
+    if (!indexed_heap_is_in_heap(heap, handle)) return ERR_INVALID_ARG;
+
+    size_t index = heap->config.position_storage[handle];
+    IndexedHeapEntry_t entry = {heap_item, handle};
+    if (indexed_heap_sift_up(heap, index, entry) == index) indexed_heap_sift_down(heap, index, entry);
+    return ERR_NONE;
+}
+
+ErrorCode_t indexed_heap_remove(IndexedHeap_t * heap, IndexedHeapHandle_t handle, void ** heap_item)
+{
+    assert(heap);
+
+    if (!indexed_heap_is_in_heap(heap, handle)) return ERR_INVALID_ARG;
+
+    size_t index = heap->config.position_storage[handle];
+    if (heap_item != NULL) *heap_item = heap->config.heap_storage[index].item;
+    indexed_heap_remove_at(heap, index);
+    return ERR_NONE;
+}
+
+size_t indexed_heap_get_remaining(IndexedHeap_t const * heap)
+{
+    assert(heap);
+
+    return heap->heap_max_size - heap->items_in_heap;
+}
+
+size_t indexed_heap_get_size(IndexedHeap_t const * heap)
+{
+    assert(heap);
+
+    return heap->items_in_heap;
+}
@@ -0,0 +1,146 @@
+#include <cemb/mpmc_copy_queue.h>
+#include <cemb/numeric_ops.h>
+
+#include <assert.h>
+#include <string.h>
+
+static ErrorCode_t mpmc_copy_queue_validate_config(MpmcCopyQueueConfig_t const * config)
+{
+    assert(config->queue_buffer);
+    assert(config->sequence_buffer);
+
+    if (config->element_size == 0) return ERR_INVALID_ARG;
+    if (config->queue_size == 0) return ERR_INVALID_ARG;
+    if (config->element_count < 2) return ERR_INVALID_ARG;
+    if (!numeric_ops_is_power_2_sz(config->element_count)) return ERR_INVALID_ARG;
+    if (config->queue_size < (config->element_count * config->element_size)) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+ErrorCode_t mpmc_copy_queue_init(MpmcCopyQueue_t * queue, MpmcCopyQueueConfig_t const * config)
+{
+    assert(queue);
+    assert(config);
+
+    ErrorCode_t ret = mpmc_copy_queue_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    queue->buffer = config->queue_buffer;
+    queue->sequences = config->sequence_buffer;
+    queue->element_size = config->element_size;
+    queue->max_size = config->element_count;
+    queue->size_mask = config->element_count - 1;
+
+    // every slot starts ready to be written at the position matching its index
+    for (size_t idx = 0; idx < queue->max_size; ++idx)
+    {
+        atomic_init(&queue->sequences[idx], idx);
+    }
+    atomic_init(&queue->enqueue_position, 0);
+    atomic_init(&queue->dequeue_position, 0);
+
+    return ret;
+}
+
+void mpmc_copy_queue_deinit(MpmcCopyQueue_t * queue)
+{
+    assert(queue);
+
+    queue->buffer = NULL;
+    queue->sequences = NULL;
+    queue->element_size = 0;
+    queue->max_size = 0;
+    queue->size_mask = 0;
+    atomic_init(&queue->enqueue_position, 0);
+    atomic_init(&queue->dequeue_position, 0);
+}
+
+ErrorCode_t mpmc_copy_queue_enqueue(MpmcCopyQueue_t * queue, void const * element)
+{
+    assert(queue);
+    assert(element);
+
+    if (queue->max_size == 0) return ERR_NO_MEM;
+
+    size_t position = atomic_load_explicit(&queue->enqueue_position, memory_order_relaxed);
+    size_t slot;
+
+    for (;;)
+    {
+        slot = position & queue->size_mask;
+        size_t sequence = atomic_load_explicit(&queue->sequences[slot], memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0)
+        {
+            // slot is free for this position, try to claim it (position is refreshed on failure)
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_position, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) break;
+        }
+        else if (difference < 0)
+        {
+            // slot still holds the element from the previous lap, the queue is full
+            return ERR_NO_MEM;
+        }
+        else
+        {
+            // another producer claimed this position
+            position = atomic_load_explicit(&queue->enqueue_position, memory_order_relaxed);
+        }
+    }
+
+    memcpy(&queue->buffer[slot * queue->element_size], element, queue->element_size);
+    atomic_store_explicit(&queue->sequences[slot], position + 1, memory_order_release);
+    return ERR_NONE;
+}
+
+ErrorCode_t mpmc_copy_queue_dequeue(MpmcCopyQueue_t * queue, void * element)
+{
+    assert(queue);
+    assert(element);
+
+    if (queue->max_size == 0) return ERR_EMPTY;
+
+    size_t position = atomic_load_explicit(&queue->dequeue_position, memory_order_relaxed);
+    size_t slot;
+
+    for (;;)
+    {
+        slot = position & queue->size_mask;
+        size_t sequence = atomic_load_explicit(&queue->sequences[slot], memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_position, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) break;
+        }
+        else if (difference < 0)
+        {
+            // slot has not been written for this lap, the queue is empty
+            return ERR_EMPTY;
+        }
+        else
+        {
+            position = atomic_load_explicit(&queue->dequeue_position, memory_order_relaxed);
+        }
+    }
+
+    memcpy(element, &queue->buffer[slot * queue->element_size], queue->element_size);
+    // hand the slot back to producers for the next lap
+    atomic_store_explicit(&queue->sequences[slot], position + queue->max_size, memory_order_release);
+    return ERR_NONE;
+}
+
+size_t mpmc_copy_queue_get_size(MpmcCopyQueue_t * queue)
+{
+    assert(queue);
+
+    size_t dequeue_position = atomic_load_explicit(&queue->dequeue_position, memory_order_acquire);
+    size_t enqueue_position = atomic_load_explicit(&queue->enqueue_position, memory_order_acquire);
+
+    // positions are read separately, so a concurrent dequeue may make the snapshot look negative or over full
+    if (enqueue_position < dequeue_position) return 0;
+    size_t size = enqueue_position - dequeue_position;
+    return (size > queue->max_size) ? queue->max_size : size;
+}
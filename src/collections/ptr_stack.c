@@ -1,6 +1,7 @@
 #include <cemb/ptr_stack.h>
 
 #include <assert.h>
+#include <string.h>
 
 ErrorCode_t ptr_stack_init(PtrStack_t * stack, void ** stack_buffer, size_t stack_item_count)
 {
@@ -52,4 +53,30 @@ ErrorCode_t ptr_stack_pop(PtrStack_t * stack, void ** value)
     *value = stack->stack[stack->stack_top];
     
     return ERR_NONE;
-}
\ No newline at end of file
+}
+
+ErrorCode_t ptr_stack_push_bulk(PtrStack_t * stack, void * const * values, size_t count)
+{
+    assert(stack);
+    assert(values);
+
+    if (ptr_stack_get_remaining_count(stack) < count) return ERR_NO_MEM;
+
+    memcpy(&stack->stack[stack->stack_top], values, count * sizeof(void *));
+    stack->stack_top += count;
+
+    return ERR_NONE;
+}
+
+ErrorCode_t ptr_stack_pop_bulk(PtrStack_t * stack, void ** values, size_t count)
+{
+    assert(stack);
+    assert(values);
+
+    if (stack->stack_top < count) return ERR_EMPTY;
+
+    stack->stack_top -= count;
+    memcpy(values, &stack->stack[stack->stack_top], count * sizeof(void *));
+
+    return ERR_NONE;
+}
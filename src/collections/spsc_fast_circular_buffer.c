@@ -0,0 +1,155 @@
+#include <cemb/spsc_fast_circular_buffer.h>
+#include <cemb/numeric_ops.h>
+#include <assert.h>
+#include <string.h>
+
+static ErrorCode_t spsc_fast_circular_buffer_validate_config(FastCircularBufferConfig_t const * buffer_config)
+{
+    assert(buffer_config->buffer);
+
+    if (buffer_config->buffer_size < 2) return ERR_INVALID_ARG;
+    if (!numeric_ops_is_power_2_sz(buffer_config->buffer_size)) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+/**
+ * @brief Gets the free space seen by the producer, only refreshing the shared read index if the cached copy is not
+ * enough to satisfy the request.
+ */
+static size_t spsc_fast_circular_buffer_get_free_count(SpscFastCircularBuffer_t * buffer, size_t write_index, size_t required)
+{
+    size_t capacity = buffer->size_mask + 1;
+    size_t free_count = capacity - (write_index - buffer->cached_read_index);
+    if (free_count < required)
+    {
+        buffer->cached_read_index = atomic_load_explicit(&buffer->read_index, memory_order_acquire);
+        free_count = capacity - (write_index - buffer->cached_read_index);
+    }
+    return free_count;
+}
+
+/**
+ * @brief Gets the number of bytes seen by the consumer, only refreshing the shared write index if the cached copy is
+ * not enough to satisfy the request.
+ */
+static size_t spsc_fast_circular_buffer_get_used_count(SpscFastCircularBuffer_t * buffer, size_t read_index, size_t required)
+{
+    size_t used_count = buffer->cached_write_index - read_index;
+    if (used_count < required)
+    {
+        buffer->cached_write_index = atomic_load_explicit(&buffer->write_index, memory_order_acquire);
+        used_count = buffer->cached_write_index - read_index;
+    }
+    return used_count;
+}
+
+ErrorCode_t spsc_fast_circular_buffer_init(SpscFastCircularBuffer_t * buffer, FastCircularBufferConfig_t const * buffer_config)
+{
+    assert(buffer);
+    assert(buffer_config);
+
+    ErrorCode_t result = spsc_fast_circular_buffer_validate_config(buffer_config);
+    if (result != ERR_NONE) return result;
+
+    buffer->buffer = buffer_config->buffer;
+    buffer->size_mask = buffer_config->buffer_size - 1;
+
+    atomic_init(&buffer->read_index, 0);
+    atomic_init(&buffer->write_index, 0);
+    buffer->cached_read_index = 0;
+    buffer->cached_write_index = 0;
+
+    return ERR_NONE;
+}
+
+void spsc_fast_circular_buffer_deinit(SpscFastCircularBuffer_t * buffer)
+{
+    assert(buffer);
+
+    buffer->size_mask = 0;
+    atomic_init(&buffer->read_index, 0);
+    atomic_init(&buffer->write_index, 0);
+    buffer->cached_read_index = 0;
+    buffer->cached_write_index = 0;
+}
+
+ErrorCode_t spsc_fast_circular_buffer_push_byte(SpscFastCircularBuffer_t * buffer, uint8_t byte)
+{
+    assert(buffer);
+
+    if (buffer->size_mask == 0) return ERR_NO_MEM;
+
+    size_t write_index = atomic_load_explicit(&buffer->write_index, memory_order_relaxed);
+    if (spsc_fast_circular_buffer_get_free_count(buffer, write_index, 1) == 0) return ERR_NO_MEM;
+
+    buffer->buffer[write_index & buffer->size_mask] = byte;
+    atomic_store_explicit(&buffer->write_index, write_index + 1, memory_order_release);
+    return ERR_NONE;
+}
+
+ErrorCode_t spsc_fast_circular_buffer_pop_byte(SpscFastCircularBuffer_t * buffer, uint8_t * byte)
+{
+    assert(buffer);
+    assert(byte);
+
+    size_t read_index = atomic_load_explicit(&buffer->read_index, memory_order_relaxed);
+    if (spsc_fast_circular_buffer_get_used_count(buffer, read_index, 1) == 0) return ERR_EMPTY;
+
+    *byte = buffer->buffer[read_index & buffer->size_mask];
+    atomic_store_explicit(&buffer->read_index, read_index + 1, memory_order_release);
+    return ERR_NONE;
+}
+
+size_t spsc_fast_circular_buffer_push(SpscFastCircularBuffer_t * buffer, uint8_t const * bytes, size_t length)
+{
+    assert(buffer);
+    assert(bytes || (length == 0));
+
+    if (buffer->size_mask == 0) return 0;
+
+    size_t write_index = atomic_load_explicit(&buffer->write_index, memory_order_relaxed);
+    size_t free_count = spsc_fast_circular_buffer_get_free_count(buffer, write_index, length);
+    if (length > free_count) length = free_count;
+    if (length == 0) return 0;
+
+    size_t write_offset = write_index & buffer->size_mask;
+    size_t first_length = (buffer->size_mask + 1) - write_offset;
+    if (first_length > length) first_length = length;
+
+    memcpy(&buffer->buffer[write_offset], bytes, first_length);
+    memcpy(buffer->buffer, &bytes[first_length], length - first_length);
+
+    atomic_store_explicit(&buffer->write_index, write_index + length, memory_order_release);
+    return length;
+}
+
+size_t spsc_fast_circular_buffer_pop(SpscFastCircularBuffer_t * buffer, uint8_t * bytes, size_t length)
+{
+    assert(buffer);
+    assert(bytes || (length == 0));
+
+    size_t read_index = atomic_load_explicit(&buffer->read_index, memory_order_relaxed);
+    size_t used_count = spsc_fast_circular_buffer_get_used_count(buffer, read_index, length);
+    if (length > used_count) length = used_count;
+    if (length == 0) return 0;
+
+    size_t read_offset = read_index & buffer->size_mask;
+    size_t first_length = (buffer->size_mask + 1) - read_offset;
+    if (first_length > length) first_length = length;
+
+    memcpy(bytes, &buffer->buffer[read_offset], first_length);
+    memcpy(&bytes[first_length], buffer->buffer, length - first_length);
+
+    atomic_store_explicit(&buffer->read_index, read_index + length, memory_order_release);
+    return length;
+}
+
+size_t spsc_fast_circular_buffer_get_count(SpscFastCircularBuffer_t * buffer)
+{
+    assert(buffer);
+
+    // read index first, so a concurrent push can only make the count larger, never wrap below 0
+    size_t read_index = atomic_load_explicit(&buffer->read_index, memory_order_acquire);
+    size_t write_index = atomic_load_explicit(&buffer->write_index, memory_order_acquire);
+    return write_index - read_index;
+}
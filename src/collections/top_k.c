@@ -0,0 +1,89 @@
+#include <cemb/top_k.h>
+
+#include <assert.h>
+
+ErrorCode_t top_k_init(TopK_t * top_k, TopKConfig_t const * config)
+{
+    assert(top_k);
+    assert(config);
+
+    // the lowest ranked item sits at the root, so a parent swaps with any child it ranks above
+    BoundedHeapConfig_t heap_config = {
+        .heap_storage = config->heap_storage,
+        .element_count = config->k,
+        .compare = config->ranks_above,
+    };
+    return bounded_heap_init(&top_k->heap, &heap_config);
+}
+
+void top_k_deinit(TopK_t * top_k)
+{
+    assert(top_k);
+
+    bounded_heap_deinit(&top_k->heap);
+}
+
+ErrorCode_t top_k_offer(TopK_t * top_k, void * item, void ** dropped_item)
+{
+    assert(top_k);
+
+    void * dropped = NULL;
+    ErrorCode_t ret = ERR_NONE;
+
+    if (bounded_heap_get_remaining(&top_k->heap) > 0)
+    {
+        bounded_heap_push(&top_k->heap, item);
+    }
+    else if (bounded_heap_get_size(&top_k->heap) == 0)
+    {
+        // no space and nothing kept, only after a deinit
+        dropped = item;
+        ret = ERR_NO_MEM;
+    }
+    else
+    {
+        void * threshold = top_k->heap.config.heap_storage[0];
+        if (top_k->heap.config.compare(item, threshold))
+        {
+            bounded_heap_replace_top(&top_k->heap, item, &dropped);
+        }
+        else
+        {
+            dropped = item;
+        }
+    }
+
+    if (dropped_item != NULL) *dropped_item = dropped;
+    return ret;
+}
+
+ErrorCode_t top_k_get_threshold(TopK_t * top_k, void ** item)
+{
+    assert(top_k);
+    assert(item);
+
+    return bounded_heap_peek(&top_k->heap, item);
+}
+
+ErrorCode_t top_k_emit_sorted(TopK_t * top_k, void ** items, size_t * count)
+{
+    assert(top_k);
+    assert(items);
+    assert(count);
+
+    // pops come out lowest ranked first, so the output is filled from the back
+    size_t item_count = bounded_heap_get_size(&top_k->heap);
+    for (size_t idx = item_count; idx > 0; --idx)
+    {
+        bounded_heap_pop(&top_k->heap, &items[idx - 1]);
+    }
+    *count = item_count;
+    return ERR_NONE;
+}
+
+size_t top_k_get_size(TopK_t const * top_k)
+{
+    assert(top_k);
+
+    return bounded_heap_get_size(&top_k->heap);
+}
@@ -0,0 +1,205 @@
+#include <cemb/arena.h>
+
+#include <assert.h>
+
+/**
+ * Keeps the block chaining out of arena_allocate, so the common path does not pay for saving the registers it uses.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define ARENA_NOINLINE __attribute__((noinline))
+#else
+#define ARENA_NOINLINE
+#endif
+
+static ErrorCode_t arena_validate_config(ArenaConfig_t const * config)
+{
+    assert(config->buffer);
+
+    if (config->buffer_size == 0) return ERR_INVALID_ARG;
+    if ((config->block_allocator != NULL) && (config->block_size <= sizeof(ArenaBlock_t))) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+/**
+ * @brief Gets the aligned start of an allocation between cursor and end, or NULL if the allocation does not fit.
+ */
+static inline uint8_t * arena_fit(uint8_t * cursor, uint8_t * end, size_t size, size_t alignment)
+{
+    size_t padding = (size_t)(-(uintptr_t)cursor) & (alignment - 1);
+    size_t available = (size_t)(end - cursor);
+
+    if ((padding > available) || (size > (available - padding))) return NULL;
+    return cursor + padding;
+}
+
+/**
+ * @brief Points the cursor and end at the given block, with the cursor at the given position.
+ */
+static void arena_set_block(Arena_t * arena, ArenaBlock_t * block, uint8_t * cursor)
+{
+    arena->block = block;
+    arena->cursor = cursor;
+    arena->end = (block == NULL) ? (arena->buffer + arena->buffer_size) : ((uint8_t *)block + arena->block_size);
+}
+
+/**
+ * @brief Returns chained blocks to the block allocator until the given block is the current block.
+ */
+static void arena_release_blocks(Arena_t * arena, ArenaBlock_t * target)
+{
+    ArenaBlock_t * block = arena->block;
+
+    while (block != target)
+    {
+        void * object = block;
+        block = block->previous;
+        i_pool_allocator_deallocate(&arena->block_allocator, &object);
+    }
+}
+
+/**
+ * @brief Checks whether a mark is at or before the given position, walking back along the chain from it.
+ */
+static bool arena_is_at_or_before(ArenaBlock_t const * block, uint8_t const * cursor, ArenaMark_t const * mark)
+{
+    if (block == mark->block) return mark->cursor <= cursor;
+
+    // the buffer is before every block, so a mark in the buffer is found once the walk reaches NULL
+    while (block != NULL)
+    {
+        block = block->previous;
+        if (block == mark->block) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Moves to the given position after releasing the blocks past it, counting the reset.
+ */
+static void arena_reset_to_position(Arena_t * arena, ArenaBlock_t * block, uint8_t * cursor)
+{
+    arena_release_blocks(arena, block);
+    arena_set_block(arena, block, cursor);
+    arena->generation++;
+    arena_mark(arena, &arena->reset_position);
+}
+
+/**
+ * @brief Chains a new block onto the arena and allocates from it, only needed once the current block is full.
+ */
+static ARENA_NOINLINE ErrorCode_t arena_allocate_from_new_block(Arena_t * arena, size_t size, size_t alignment,
+                                                                void ** object_pointer)
+{
+    if (arena->block_size == 0) return ERR_NO_MEM;
+
+    void * object;
+    if (i_pool_allocator_allocate(&arena->block_allocator, &object) != ERR_NONE) return ERR_NO_MEM;
+
+    // the block address decides the padding, so a block that cannot fit the allocation is given straight back
+    ArenaBlock_t * block = object;
+    uint8_t * start = arena_fit((uint8_t *)(block + 1), (uint8_t *)block + arena->block_size, size, alignment);
+    if (start == NULL)
+    {
+        i_pool_allocator_deallocate(&arena->block_allocator, &object);
+        return ERR_NO_MEM;
+    }
+
+    block->previous = arena->block;
+    arena_set_block(arena, block, start + size);
+    *object_pointer = start;
+    return ERR_NONE;
+}
+
+ErrorCode_t arena_init(Arena_t * arena, ArenaConfig_t const * config)
+{
+    assert(arena);
+    assert(config);
+
+    ErrorCode_t ret = arena_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    arena->buffer = config->buffer;
+    arena->buffer_size = config->buffer_size;
+    if (config->block_allocator != NULL)
+    {
+        arena->block_allocator = *config->block_allocator;
+        arena->block_size = config->block_size;
+    }
+    else
+    {
+        arena->block_size = 0;
+    }
+    arena_set_block(arena, NULL, arena->buffer);
+    arena->generation = 0;
+    arena_mark(arena, &arena->reset_position);
+    return ERR_NONE;
+}
+
+void arena_deinit(Arena_t * arena)
+{
+    assert(arena);
+
+    arena_release_blocks(arena, NULL);
+    arena->buffer_size = 0;
+    arena->block_size = 0;
+    arena_set_block(arena, NULL, arena->buffer);
+}
+
+ErrorCode_t arena_allocate(Arena_t * arena, size_t size, size_t alignment, void ** object_pointer)
+{
+    assert(arena);
+    assert(object_pointer);
+
+    if ((alignment == 0) || ((alignment & (alignment - 1)) != 0)) return ERR_INVALID_ARG;
+
+    uint8_t * start = arena_fit(arena->cursor, arena->end, size, alignment);
+    if (start == NULL) return arena_allocate_from_new_block(arena, size, alignment, object_pointer);
+
+    arena->cursor = start + size;
+    *object_pointer = start;
+    return ERR_NONE;
+}
+
+void arena_mark(Arena_t const * arena, ArenaMark_t * mark)
+{
+    assert(arena);
+    assert(mark);
+
+    mark->block = arena->block;
+    mark->cursor = arena->cursor;
+    mark->generation = arena->generation;
+}
+
+ErrorCode_t arena_reset_to_mark(Arena_t * arena, ArenaMark_t const * mark)
+{
+    assert(arena);
+    assert(mark);
+
+    // the mark's block must still be in the chain, and not be past the current position within it
+    if (!arena_is_at_or_before(arena->block, arena->cursor, mark)) return ERR_INVALID_ARG;
+
+    // the arena has been reset since the mark was taken, if that went to a position before the mark, the space after
+    // it may have been handed out again, or its block replaced by another at the same address
+    if ((mark->generation != arena->generation) &&
+        !arena_is_at_or_before(arena->reset_position.block, arena->reset_position.cursor, mark))
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    arena_reset_to_position(arena, mark->block, mark->cursor);
+    return ERR_NONE;
+}
+
+void arena_reset(Arena_t * arena)
+{
+    assert(arena);
+
+    arena_reset_to_position(arena, NULL, arena->buffer);
+}
+
+size_t arena_get_remaining(Arena_t const * arena)
+{
+    assert(arena);
+
+    return (size_t)(arena->end - arena->cursor);
+}
@@ -0,0 +1,161 @@
+#include <cemb/bitmap_pool.h>
+#include <cemb/bit_ops.h>
+
+#include <assert.h>
+
+#define BITMAP_POOL_BITS_PER_WORD (32)
+
+static ErrorCode_t bitmap_pool_validate_config(BitmapPoolConfig_t const * config)
+{
+    assert(config->buffer);
+    assert(config->bitmap);
+
+    if (config->object_size == 0) return ERR_INVALID_ARG;
+    if (config->object_count == 0) return ERR_INVALID_ARG;
+    if (config->buffer_size < (config->object_size * config->object_count)) return ERR_INVALID_ARG;
+    if (config->bitmap_word_count < BITMAP_POOL_BITMAP_WORD_COUNT(config->object_count)) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+/**
+ * @brief Gets the index of an object from its pointer.
+ *
+ * @retval #ERR_NONE
+ * @retval #ERR_OUT_OF_BOUNDS - The pointer is not the start of an object in this pool
+ */
+static ErrorCode_t bitmap_pool_get_index(BitmapPool_t const * pool, void const * object, size_t * index)
+{
+    uint8_t const * object_bytes = object;
+
+    if (object_bytes == NULL) return ERR_OUT_OF_BOUNDS;
+    if (object_bytes < pool->buffer) return ERR_OUT_OF_BOUNDS;
+
+    size_t offset = (size_t)(object_bytes - pool->buffer);
+    if (offset >= (pool->object_size * pool->object_count)) return ERR_OUT_OF_BOUNDS;
+    if ((offset % pool->object_size) != 0) return ERR_OUT_OF_BOUNDS;
+
+    *index = offset / pool->object_size;
+    return ERR_NONE;
+}
+
+static inline bool bitmap_pool_is_free(BitmapPool_t const * pool, size_t index)
+{
+    uint32_t mask = (uint32_t)1 << (index % BITMAP_POOL_BITS_PER_WORD);
+    return (pool->bitmap[index / BITMAP_POOL_BITS_PER_WORD] & mask) != 0;
+}
+
+ErrorCode_t bitmap_pool_as_i_pool_allocator(BitmapPool_t * pool, IPoolAllocator_t * interface)
+{
+    assert(pool);
+    assert(interface);
+
+    interface->context = (void *) pool;
+    interface->allocate = (i_pool_allocate_allocate_t)bitmap_pool_allocate;
+    interface->deallocate = (i_pool_allocate_deallocate_t)bitmap_pool_deallocate;
+    interface->get_available_count = (i_pool_allocate_get_available_count_t)bitmap_pool_get_available_count;
+    interface->allocate_sized = NULL;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
+    return ERR_NONE;
+}
+
+ErrorCode_t bitmap_pool_init(BitmapPool_t * pool, BitmapPoolConfig_t const * config)
+{
+    assert(pool);
+    assert(config);
+
+    ErrorCode_t ret = bitmap_pool_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    pool->buffer = config->buffer;
+    pool->bitmap = config->bitmap;
+    pool->bitmap_word_count = BITMAP_POOL_BITMAP_WORD_COUNT(config->object_count);
+    pool->object_size = config->object_size;
+    pool->object_count = config->object_count;
+    pool->available_count = config->object_count;
+    pool->search_word = 0;
+
+    for (size_t idx = 0; idx < pool->bitmap_word_count; ++idx)
+    {
+        pool->bitmap[idx] = UINT32_MAX;
+    }
+
+    // bits past the last object are never free
+    size_t used_bits = pool->object_count % BITMAP_POOL_BITS_PER_WORD;
+    if (used_bits != 0)
+    {
+        pool->bitmap[pool->bitmap_word_count - 1] = ((uint32_t)1 << used_bits) - 1;
+    }
+
+    return ERR_NONE;
+}
+
+void bitmap_pool_deinit(BitmapPool_t * pool)
+{
+    assert(pool);
+
+    pool->buffer = NULL;
+    pool->bitmap = NULL;
+    pool->bitmap_word_count = 0;
+    pool->object_size = 0;
+    pool->object_count = 0;
+    pool->available_count = 0;
+    pool->search_word = 0;
+}
+
+ErrorCode_t bitmap_pool_allocate(BitmapPool_t * pool, void ** object_pointer)
+{
+    assert(pool);
+    assert(object_pointer);
+
+    if (pool->available_count == 0) return ERR_NO_MEM;
+
+    // there is a free object, so this finds one before wrapping back to the starting word
+    size_t word = pool->search_word;
+    while (pool->bitmap[word] == 0)
+    {
+        word++;
+        if (word == pool->bitmap_word_count) word = 0;
+    }
+
+    uint32_t bit = bit_ops_count_trailing_zeros_u32(pool->bitmap[word]);
+    pool->bitmap[word] &= ~((uint32_t)1 << bit);
+    pool->search_word = word;
+    pool->available_count--;
+
+    *object_pointer = (void *)&pool->buffer[((word * BITMAP_POOL_BITS_PER_WORD) + bit) * pool->object_size];
+    return ERR_NONE;
+}
+
+ErrorCode_t bitmap_pool_deallocate(BitmapPool_t * pool, void ** object_pointer)
+{
+    assert(pool);
+    assert(object_pointer);
+
+    size_t index;
+    ErrorCode_t ret = bitmap_pool_get_index(pool, *object_pointer, &index);
+    if (ret != ERR_NONE) return ret;
+    if (bitmap_pool_is_free(pool, index)) return ERR_INVALID_STATE;
+
+    pool->bitmap[index / BITMAP_POOL_BITS_PER_WORD] |= ((uint32_t)1 << (index % BITMAP_POOL_BITS_PER_WORD));
+    pool->available_count++;
+    *object_pointer = NULL;
+    return ERR_NONE;
+}
+
+ErrorCode_t bitmap_pool_check(BitmapPool_t const * pool, void const * object)
+{
+    assert(pool);
+
+    size_t index;
+    ErrorCode_t ret = bitmap_pool_get_index(pool, object, &index);
+    if (ret != ERR_NONE) return ret;
+    return bitmap_pool_is_free(pool, index) ? ERR_INVALID_STATE : ERR_NONE;
+}
+
+size_t bitmap_pool_get_available_count(BitmapPool_t * pool)
+{
+    assert(pool);
+
+    return pool->available_count;
+}
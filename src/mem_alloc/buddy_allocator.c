@@ -0,0 +1,233 @@
+#include <cemb/buddy_allocator.h>
+#include <cemb/bit_ops.h>
+#include <cemb/numeric_ops.h>
+
+#include <assert.h>
+#include <string.h>
+
+#define BUDDY_ALLOCATOR_MAX_BUFFER_SIZE ((size_t)1 << 31)
+
+static inline bool buddy_allocator_test_bit(uint32_t const * bitmap, size_t node)
+{
+    return (bitmap[node / 32] & ((uint32_t)1 << (node % 32))) != 0;
+}
+
+static inline void buddy_allocator_set_bit(uint32_t * bitmap, size_t node)
+{
+    bitmap[node / 32] |= ((uint32_t)1 << (node % 32));
+}
+
+static inline void buddy_allocator_clear_bit(uint32_t * bitmap, size_t node)
+{
+    bitmap[node / 32] &= ~((uint32_t)1 << (node % 32));
+}
+
+static inline size_t buddy_allocator_get_block_size(BuddyAllocator_t const * buddy, uint32_t level)
+{
+    return (size_t)1 << (buddy->buffer_size_log2 - level);
+}
+
+/**
+ * @brief Gets the tree node of the block at this offset and level, nodes are numbered breadth first from the root.
+ */
+static inline size_t buddy_allocator_get_node(BuddyAllocator_t const * buddy, size_t offset, uint32_t level)
+{
+    return (((size_t)1 << level) - 1) + (offset >> (buddy->buffer_size_log2 - level));
+}
+
+static void buddy_allocator_push_free(BuddyAllocator_t * buddy, uint8_t * block, uint32_t level)
+{
+    BuddyFreeBlock_t * free_block = (BuddyFreeBlock_t *)block;
+    BuddyFreeBlock_t * head = buddy->free_lists[level];
+
+    free_block->next = head;
+    free_block->previous = NULL;
+    if (head != NULL) head->previous = free_block;
+    buddy->free_lists[level] = free_block;
+
+    buddy_allocator_set_bit(buddy->free_bitmap, buddy_allocator_get_node(buddy, (size_t)(block - buddy->buffer), level));
+    buddy->free_bytes += buddy_allocator_get_block_size(buddy, level);
+}
+
+static void buddy_allocator_remove_free(BuddyAllocator_t * buddy, uint8_t * block, uint32_t level)
+{
+    BuddyFreeBlock_t * free_block = (BuddyFreeBlock_t *)block;
+
+    if (free_block->next != NULL) free_block->next->previous = free_block->previous;
+    if (free_block->previous != NULL)
+    {
+        free_block->previous->next = free_block->next;
+    }
+    else
+    {
+        buddy->free_lists[level] = free_block->next;
+    }
+
+    buddy_allocator_clear_bit(buddy->free_bitmap, buddy_allocator_get_node(buddy, (size_t)(block - buddy->buffer), level));
+    buddy->free_bytes -= buddy_allocator_get_block_size(buddy, level);
+}
+
+/**
+ * @brief Allocates a block of the smallest size, the deepest level of the tree.
+ */
+static ErrorCode_t buddy_allocator_allocate_unsized(BuddyAllocator_t * buddy, void ** object_pointer)
+{
+    assert(buddy);
+    assert(object_pointer);
+
+    return buddy_allocator_allocate(buddy, buddy_allocator_get_block_size(buddy, buddy->level_count - 1),
+                                    object_pointer);
+}
+
+static ErrorCode_t buddy_allocator_validate_config(BuddyAllocatorConfig_t const * config)
+{
+    assert(config->buffer);
+    assert(config->bitmap);
+
+    if (!numeric_ops_is_power_2_sz(config->buffer_size)) return ERR_INVALID_ARG;
+    if (!numeric_ops_is_power_2_sz(config->min_block_size)) return ERR_INVALID_ARG;
+    if (config->buffer_size > BUDDY_ALLOCATOR_MAX_BUFFER_SIZE) return ERR_INVALID_ARG;
+    if (config->min_block_size < sizeof(BuddyFreeBlock_t)) return ERR_INVALID_ARG;
+    if (config->min_block_size > config->buffer_size) return ERR_INVALID_ARG;
+
+    uint32_t level_count = bit_ops_find_last_set_u32((uint32_t)(config->buffer_size / config->min_block_size));
+    if (level_count > BUDDY_ALLOCATOR_MAX_LEVELS) return ERR_INVALID_ARG;
+
+    size_t required_words = BUDDY_ALLOCATOR_BITMAP_WORD_COUNT(config->buffer_size, config->min_block_size);
+    if (config->bitmap_word_count < required_words) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+ErrorCode_t buddy_allocator_as_i_pool_allocator(BuddyAllocator_t * buddy, IPoolAllocator_t * interface)
+{
+    assert(buddy);
+    assert(interface);
+
+    interface->context = (void *) buddy;
+    interface->allocate = (i_pool_allocate_allocate_t)buddy_allocator_allocate_unsized;
+    interface->deallocate = (i_pool_allocate_deallocate_t)buddy_allocator_deallocate;
+    interface->get_available_count = (i_pool_allocate_get_available_count_t)buddy_allocator_get_free_bytes;
+    interface->allocate_sized = (i_pool_allocate_allocate_sized_t)buddy_allocator_allocate;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
+    return ERR_NONE;
+}
+
+ErrorCode_t buddy_allocator_init(BuddyAllocator_t * buddy, BuddyAllocatorConfig_t const * config)
+{
+    assert(buddy);
+    assert(config);
+
+    ErrorCode_t ret = buddy_allocator_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    size_t half_word_count = BUDDY_ALLOCATOR_BITMAP_WORD_COUNT(config->buffer_size, config->min_block_size) / 2;
+
+    buddy->buffer = config->buffer;
+    buddy->buffer_size = config->buffer_size;
+    buddy->buffer_size_log2 = bit_ops_find_last_set_u32((uint32_t)config->buffer_size) - 1;
+    buddy->level_count = bit_ops_find_last_set_u32((uint32_t)(config->buffer_size / config->min_block_size));
+    buddy->split_bitmap = config->bitmap;
+    buddy->free_bitmap = &config->bitmap[half_word_count];
+    buddy->free_bytes = 0;
+    memset(config->bitmap, 0, half_word_count * 2 * sizeof(uint32_t));
+    memset(buddy->free_lists, 0, sizeof(buddy->free_lists));
+
+    buddy_allocator_push_free(buddy, buddy->buffer, 0);
+    return ERR_NONE;
+}
+
+void buddy_allocator_deinit(BuddyAllocator_t * buddy)
+{
+    assert(buddy);
+
+    // the sizes are kept so requests are still validated, but there are no free blocks to serve them
+    buddy->buffer = NULL;
+    buddy->free_bytes = 0;
+    memset(buddy->free_lists, 0, sizeof(buddy->free_lists));
+}
+
+ErrorCode_t buddy_allocator_allocate(BuddyAllocator_t * buddy, size_t size, void ** object_pointer)
+{
+    assert(buddy);
+    assert(object_pointer);
+
+    if ((size == 0) || (size > buddy->buffer_size)) return ERR_INVALID_ARG;
+
+    // the deepest level whose blocks still hold the request
+    uint32_t target_level = buddy->level_count - 1;
+    if (size > buddy_allocator_get_block_size(buddy, target_level))
+    {
+        uint32_t size_log2 = bit_ops_find_last_set_u32((uint32_t)(size - 1));
+        target_level = buddy->buffer_size_log2 - size_log2;
+    }
+
+    uint32_t level = target_level + 1;
+    while ((level > 0) && (buddy->free_lists[level - 1] == NULL))
+    {
+        level--;
+    }
+    if (level == 0) return ERR_NO_MEM;
+    level--;
+
+    uint8_t * block = (uint8_t *)buddy->free_lists[level];
+    buddy_allocator_remove_free(buddy, block, level);
+
+    // split down to the target, keeping the first half and freeing the second
+    for (; level < target_level; ++level)
+    {
+        size_t node = buddy_allocator_get_node(buddy, (size_t)(block - buddy->buffer), level);
+        buddy_allocator_set_bit(buddy->split_bitmap, node);
+        buddy_allocator_push_free(buddy, block + buddy_allocator_get_block_size(buddy, level + 1), level + 1);
+    }
+
+    *object_pointer = block;
+    return ERR_NONE;
+}
+
+ErrorCode_t buddy_allocator_deallocate(BuddyAllocator_t * buddy, void ** object_pointer)
+{
+    assert(buddy);
+    assert(object_pointer);
+
+    uint8_t * block = *object_pointer;
+    if ((block < buddy->buffer) || (block >= (buddy->buffer + buddy->buffer_size))) return ERR_OUT_OF_BOUNDS;
+
+    // every ancestor of a block is split and nothing below it is, so walk up from the smallest block to the first split
+    // ancestor, small blocks are found straight away
+    size_t offset = (size_t)(block - buddy->buffer);
+    uint32_t level = buddy->level_count - 1;
+    size_t node = buddy_allocator_get_node(buddy, offset, level);
+    while ((level > 0) && !buddy_allocator_test_bit(buddy->split_bitmap, (node - 1) / 2))
+    {
+        level--;
+        node = (node - 1) / 2;
+    }
+
+    if ((offset & (buddy_allocator_get_block_size(buddy, level) - 1)) != 0) return ERR_OUT_OF_BOUNDS;
+    if (buddy_allocator_test_bit(buddy->free_bitmap, node)) return ERR_INVALID_STATE;
+
+    // merge upwards while the buddy is a whole free block
+    while (level > 0)
+    {
+        size_t buddy_offset = offset ^ buddy_allocator_get_block_size(buddy, level);
+        size_t buddy_node = buddy_allocator_get_node(buddy, buddy_offset, level);
+        if (!buddy_allocator_test_bit(buddy->free_bitmap, buddy_node)) break;
+
+        buddy_allocator_remove_free(buddy, buddy->buffer + buddy_offset, level);
+        level--;
+        offset &= ~buddy_allocator_get_block_size(buddy, level + 1);
+        buddy_allocator_clear_bit(buddy->split_bitmap, buddy_allocator_get_node(buddy, offset, level));
+    }
+
+    buddy_allocator_push_free(buddy, buddy->buffer + offset, level);
+    *object_pointer = NULL;
+    return ERR_NONE;
+}
+
+size_t buddy_allocator_get_free_bytes(BuddyAllocator_t * buddy)
+{
+    assert(buddy);
+
+    return buddy->free_bytes;
+}
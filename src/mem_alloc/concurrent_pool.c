@@ -0,0 +1,141 @@
+#include <cemb/concurrent_pool.h>
+
+#include <assert.h>
+
+#define CONCURRENT_POOL_INDEX_MASK (0xFFFFFFFFull)
+#define CONCURRENT_POOL_TAG_INCREMENT (0x100000000ull)
+
+static ErrorCode_t concurrent_pool_validate_config(ConcurrentPoolConfig_t const * config)
+{
+    assert(config->buffer);
+    assert(config->link_buffer);
+
+    if (config->object_size == 0) return ERR_INVALID_ARG;
+    if (config->object_count == 0) return ERR_INVALID_ARG;
+    if (config->object_count >= CONCURRENT_POOL_INDEX_MASK) return ERR_INVALID_ARG;
+    if (config->buffer_size < (config->object_size * config->object_count)) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+/**
+ * @brief Builds a new head from the previous head, with the tag advanced and the top replaced.
+ */
+static inline uint_least64_t concurrent_pool_make_head(uint_least64_t previous_head, size_t top)
+{
+    return ((previous_head & ~CONCURRENT_POOL_INDEX_MASK) + CONCURRENT_POOL_TAG_INCREMENT) | (uint_least64_t)top;
+}
+
+ErrorCode_t concurrent_pool_as_i_pool_allocator(ConcurrentPool_t * pool, IPoolAllocator_t * interface)
+{
+    assert(pool);
+    assert(interface);
+
+    interface->context = (void *) pool;
+    interface->allocate = (i_pool_allocate_allocate_t)concurrent_pool_allocate;
+    interface->deallocate = (i_pool_allocate_deallocate_t)concurrent_pool_deallocate;
+    interface->get_available_count = (i_pool_allocate_get_available_count_t)concurrent_pool_get_available_count;
+    interface->allocate_sized = NULL;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
+    return ERR_NONE;
+}
+
+ErrorCode_t concurrent_pool_init(ConcurrentPool_t * pool, ConcurrentPoolConfig_t const * config)
+{
+    assert(pool);
+    assert(config);
+
+    ErrorCode_t ret = concurrent_pool_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    pool->buffer = config->buffer;
+    pool->links = config->link_buffer;
+    pool->object_size = config->object_size;
+    pool->object_count = config->object_count;
+
+    // links hold index + 1 of the next free object, so 0 marks the end of the list
+    for (size_t idx = 0; idx < pool->object_count; ++idx)
+    {
+        atomic_init(&pool->links[idx], ((idx + 1) < pool->object_count) ? (idx + 2) : 0);
+    }
+    atomic_init(&pool->head, 1);
+    atomic_init(&pool->available_count, pool->object_count);
+
+    return ERR_NONE;
+}
+
+void concurrent_pool_deinit(ConcurrentPool_t * pool)
+{
+    assert(pool);
+
+    pool->buffer = NULL;
+    pool->links = NULL;
+    pool->object_size = 0;
+    pool->object_count = 0;
+    atomic_init(&pool->head, 0);
+    atomic_init(&pool->available_count, 0);
+}
+
+ErrorCode_t concurrent_pool_allocate(ConcurrentPool_t * pool, void ** object_pointer)
+{
+    assert(pool);
+    assert(object_pointer);
+
+    uint_least64_t head = atomic_load_explicit(&pool->head, memory_order_acquire);
+    uint_least64_t next_head;
+    size_t top;
+
+    do
+    {
+        top = (size_t)(head & CONCURRENT_POOL_INDEX_MASK);
+        if (top == 0) return ERR_NO_MEM;
+
+        // if another thread takes this object first the link may be stale, but then the tag has moved and the CAS fails
+        size_t next = atomic_load_explicit(&pool->links[top - 1], memory_order_relaxed);
+        next_head = concurrent_pool_make_head(head, next);
+    } while (!atomic_compare_exchange_weak_explicit(&pool->head, &head, next_head, memory_order_acquire,
+                                                    memory_order_acquire));
+
+    atomic_fetch_sub_explicit(&pool->available_count, 1, memory_order_relaxed);
+    *object_pointer = (void *)&pool->buffer[(top - 1) * pool->object_size];
+    return ERR_NONE;
+}
+
+ErrorCode_t concurrent_pool_deallocate(ConcurrentPool_t * pool, void ** object_pointer)
+{
+    assert(pool);
+    assert(object_pointer);
+
+    uint8_t * object = *object_pointer;
+
+    if (object == NULL) return ERR_OUT_OF_BOUNDS;
+    if (object < pool->buffer) return ERR_OUT_OF_BOUNDS;
+
+    size_t offset = (size_t)(object - pool->buffer);
+    if (offset >= (pool->object_size * pool->object_count)) return ERR_OUT_OF_BOUNDS;
+    if ((offset % pool->object_size) != 0) return ERR_OUT_OF_BOUNDS;
+
+    size_t top = (offset / pool->object_size) + 1;
+
+    // counted before the object is visible, so an allocate that takes it can never decrement the count below zero
+    atomic_fetch_add_explicit(&pool->available_count, 1, memory_order_relaxed);
+
+    uint_least64_t head = atomic_load_explicit(&pool->head, memory_order_relaxed);
+
+    do
+    {
+        atomic_store_explicit(&pool->links[top - 1], (size_t)(head & CONCURRENT_POOL_INDEX_MASK),
+                              memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&pool->head, &head, concurrent_pool_make_head(head, top),
+                                                    memory_order_release, memory_order_relaxed));
+
+    *object_pointer = NULL;
+    return ERR_NONE;
+}
+
+size_t concurrent_pool_get_available_count(ConcurrentPool_t * pool)
+{
+    assert(pool);
+
+    return atomic_load_explicit(&pool->available_count, memory_order_relaxed);
+}
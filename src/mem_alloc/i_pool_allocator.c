@@ -10,6 +10,15 @@ inline ErrorCode_t i_pool_allocator_allocate(IPoolAllocator_t const * interface,
     return interface->allocate(interface->context, object_ptr);
 }
 
+inline ErrorCode_t i_pool_allocator_allocate_sized(IPoolAllocator_t const * interface, size_t size, void ** object_ptr)
+{
+    assert(interface);
+    assert(object_ptr);
+
+    if (interface->allocate_sized == NULL) return ERR_NOT_IMPLEMENTED;
+    return interface->allocate_sized(interface->context, size, object_ptr);
+}
+
 inline ErrorCode_t i_pool_allocator_deallocate(IPoolAllocator_t const * interface, void ** object_ptr)
 {
     assert(interface);
@@ -18,6 +27,46 @@ inline ErrorCode_t i_pool_allocator_deallocate(IPoolAllocator_t const * interfac
     return interface->deallocate(interface->context, object_ptr);
 }
 
+ErrorCode_t i_pool_allocator_allocate_bulk(IPoolAllocator_t const * interface, void ** object_ptrs, size_t count)
+{
+    assert(interface);
+    assert(object_ptrs);
+
+    if (interface->allocate_bulk != NULL) return interface->allocate_bulk(interface->context, object_ptrs, count);
+
+    for (size_t idx = 0; idx < count; ++idx)
+    {
+        ErrorCode_t ret = interface->allocate(interface->context, &object_ptrs[idx]);
+        if (ret != ERR_NONE)
+        {
+            // give back what was taken, so a failed bulk allocate leaves the pool as it was
+            while (idx > 0)
+            {
+                idx--;
+                interface->deallocate(interface->context, &object_ptrs[idx]);
+            }
+            return ret;
+        }
+    }
+    return ERR_NONE;
+}
+
+ErrorCode_t i_pool_allocator_deallocate_bulk(IPoolAllocator_t const * interface, void ** object_ptrs, size_t count)
+{
+    assert(interface);
+    assert(object_ptrs);
+
+    if (interface->deallocate_bulk != NULL) return interface->deallocate_bulk(interface->context, object_ptrs, count);
+
+    ErrorCode_t first_error = ERR_NONE;
+    for (size_t idx = 0; idx < count; ++idx)
+    {
+        ErrorCode_t ret = interface->deallocate(interface->context, &object_ptrs[idx]);
+        if (first_error == ERR_NONE) first_error = ret;
+    }
+    return first_error;
+}
+
 inline size_t i_pool_allocator_get_available_count(IPoolAllocator_t const * interface)
 {
     assert(interface);
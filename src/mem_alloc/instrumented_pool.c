@@ -0,0 +1,224 @@
+#include <cemb/instrumented_pool.h>
+#include <cemb/bit_ops.h>
+
+#include <assert.h>
+#include <string.h>
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+
+static inline void instrumented_pool_increment(atomic_size_t * counter)
+{
+    atomic_fetch_add_explicit(counter, 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Counts a successful allocation, raising the high water mark if this is the most objects in use so far.
+ */
+static void instrumented_pool_record_allocate(InstrumentedPool_t * pool, uint32_t start_ticks)
+{
+    if (pool->get_ticks != NULL)
+    {
+        uint32_t bucket = bit_ops_find_last_set_u32(pool->get_ticks() - start_ticks);
+        if (bucket >= INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT) bucket = INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT - 1;
+        instrumented_pool_increment(&pool->latency_histogram[bucket]);
+    }
+
+    instrumented_pool_increment(&pool->allocate_count);
+
+    // the count this allocation made is raised from, rather than one read separately which other threads may change
+    size_t in_use_count = atomic_fetch_add_explicit(&pool->in_use_count, 1, memory_order_relaxed) + 1;
+    size_t high_water_mark = atomic_load_explicit(&pool->high_water_mark, memory_order_relaxed);
+    while ((in_use_count > high_water_mark) &&
+           !atomic_compare_exchange_weak_explicit(&pool->high_water_mark, &high_water_mark, in_use_count,
+                                                  memory_order_relaxed, memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Uncounts an object about to be freed, before it goes back to the backing allocator.
+ *
+ * Uncounting first means an object is never counted while another thread can allocate it again, so the in use count
+ * never exceeds the objects the backing allocator has handed out. An object freed with none counted cannot be from this
+ * pool, and is left uncounted so the count does not wrap.
+ *
+ * @returns true if the object was uncounted, and must be counted again if the free fails.
+ */
+static bool instrumented_pool_release_in_use(InstrumentedPool_t * pool)
+{
+    size_t in_use_count = atomic_load_explicit(&pool->in_use_count, memory_order_relaxed);
+    do
+    {
+        if (in_use_count == 0) return false;
+    } while (!atomic_compare_exchange_weak_explicit(&pool->in_use_count, &in_use_count, in_use_count - 1,
+                                                    memory_order_relaxed, memory_order_relaxed));
+    return true;
+}
+
+static inline uint32_t instrumented_pool_get_start_ticks(InstrumentedPool_t * pool)
+{
+    return (pool->get_ticks != NULL) ? pool->get_ticks() : 0;
+}
+
+#endif
+
+ErrorCode_t instrumented_pool_as_i_pool_allocator(InstrumentedPool_t * pool, IPoolAllocator_t * interface)
+{
+    assert(pool);
+    assert(interface);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    interface->context = (void *) pool;
+    interface->allocate = (i_pool_allocate_allocate_t)instrumented_pool_allocate;
+    interface->deallocate = (i_pool_allocate_deallocate_t)instrumented_pool_deallocate;
+    interface->get_available_count = (i_pool_allocate_get_available_count_t)instrumented_pool_get_available_count;
+    interface->allocate_sized = (i_pool_allocate_allocate_sized_t)instrumented_pool_allocate_sized;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
+#else
+    *interface = pool->backing_allocator;
+#endif
+    return ERR_NONE;
+}
+
+ErrorCode_t instrumented_pool_init(InstrumentedPool_t * pool, InstrumentedPoolConfig_t const * config)
+{
+    assert(pool);
+    assert(config);
+    assert(config->backing_allocator);
+
+    pool->backing_allocator = *config->backing_allocator;
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    pool->get_ticks = config->get_ticks;
+    atomic_init(&pool->allocate_count, 0);
+    atomic_init(&pool->failure_count, 0);
+    atomic_init(&pool->deallocate_count, 0);
+    atomic_init(&pool->in_use_count, 0);
+    atomic_init(&pool->high_water_mark, 0);
+    for (size_t idx = 0; idx < INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT; ++idx)
+    {
+        atomic_init(&pool->latency_histogram[idx], 0);
+    }
+#endif
+    return ERR_NONE;
+}
+
+void instrumented_pool_deinit(InstrumentedPool_t * pool)
+{
+    assert(pool);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    pool->get_ticks = NULL;
+#else
+    (void)pool;
+#endif
+}
+
+ErrorCode_t instrumented_pool_allocate(InstrumentedPool_t * pool, void ** object_pointer)
+{
+    assert(pool);
+    assert(object_pointer);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    uint32_t start_ticks = instrumented_pool_get_start_ticks(pool);
+    ErrorCode_t ret = i_pool_allocator_allocate(&pool->backing_allocator, object_pointer);
+    if (ret == ERR_NONE)
+    {
+        instrumented_pool_record_allocate(pool, start_ticks);
+    }
+    else
+    {
+        instrumented_pool_increment(&pool->failure_count);
+    }
+    return ret;
+#else
+    return i_pool_allocator_allocate(&pool->backing_allocator, object_pointer);
+#endif
+}
+
+ErrorCode_t instrumented_pool_allocate_sized(InstrumentedPool_t * pool, size_t size, void ** object_pointer)
+{
+    assert(pool);
+    assert(object_pointer);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    uint32_t start_ticks = instrumented_pool_get_start_ticks(pool);
+    ErrorCode_t ret = i_pool_allocator_allocate_sized(&pool->backing_allocator, size, object_pointer);
+    if (ret == ERR_NONE)
+    {
+        instrumented_pool_record_allocate(pool, start_ticks);
+    }
+    else
+    {
+        instrumented_pool_increment(&pool->failure_count);
+    }
+    return ret;
+#else
+    return i_pool_allocator_allocate_sized(&pool->backing_allocator, size, object_pointer);
+#endif
+}
+
+ErrorCode_t instrumented_pool_deallocate(InstrumentedPool_t * pool, void ** object_pointer)
+{
+    assert(pool);
+    assert(object_pointer);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    bool released = instrumented_pool_release_in_use(pool);
+    ErrorCode_t ret = i_pool_allocator_deallocate(&pool->backing_allocator, object_pointer);
+    if (ret == ERR_NONE)
+    {
+        instrumented_pool_increment(&pool->deallocate_count);
+    }
+    else if (released)
+    {
+        instrumented_pool_increment(&pool->in_use_count);
+    }
+    return ret;
+#else
+    return i_pool_allocator_deallocate(&pool->backing_allocator, object_pointer);
+#endif
+}
+
+size_t instrumented_pool_get_available_count(InstrumentedPool_t * pool)
+{
+    assert(pool);
+
+    return i_pool_allocator_get_available_count(&pool->backing_allocator);
+}
+
+ErrorCode_t instrumented_pool_get_snapshot(InstrumentedPool_t * pool, InstrumentedPoolSnapshot_t * snapshot)
+{
+    assert(pool);
+    assert(snapshot);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    snapshot->allocate_count = atomic_load_explicit(&pool->allocate_count, memory_order_relaxed);
+    snapshot->failure_count = atomic_load_explicit(&pool->failure_count, memory_order_relaxed);
+    snapshot->deallocate_count = atomic_load_explicit(&pool->deallocate_count, memory_order_relaxed);
+    snapshot->in_use_count = atomic_load_explicit(&pool->in_use_count, memory_order_relaxed);
+    snapshot->high_water_mark = atomic_load_explicit(&pool->high_water_mark, memory_order_relaxed);
+    for (size_t idx = 0; idx < INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT; ++idx)
+    {
+        snapshot->latency_histogram[idx] = atomic_load_explicit(&pool->latency_histogram[idx], memory_order_relaxed);
+    }
+    return ERR_NONE;
+#else
+    (void)pool;
+    memset(snapshot, 0, sizeof(*snapshot));
+    return ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+void instrumented_pool_reset_high_water_mark(InstrumentedPool_t * pool)
+{
+    assert(pool);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    size_t in_use_count = atomic_load_explicit(&pool->in_use_count, memory_order_relaxed);
+    atomic_store_explicit(&pool->high_water_mark, in_use_count, memory_order_relaxed);
+#else
+    (void)pool;
+#endif
+}
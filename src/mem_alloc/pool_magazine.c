@@ -0,0 +1,166 @@
+#include <cemb/pool_magazine.h>
+
+#include <assert.h>
+#include <string.h>
+
+static ErrorCode_t pool_magazine_validate_config(PoolMagazineConfig_t const * config)
+{
+    assert(config->backing_allocator);
+    assert(config->object_buffer);
+
+    if (config->magazine_size == 0) return ERR_INVALID_ARG;
+    if (config->batch_size == 0) return ERR_INVALID_ARG;
+    if (config->batch_size > config->magazine_size) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+/**
+ * @brief Moves up to count objects from the top of the magazine to the backing allocator in one bulk call.
+ */
+static void pool_magazine_return_objects(PoolMagazine_t * magazine, size_t count)
+{
+    size_t cached_count = pool_magazine_get_cached_count(magazine);
+    if (count > cached_count) count = cached_count;
+    if (count == 0) return;
+
+    magazine->cache.stack_top -= count;
+    i_pool_allocator_deallocate_bulk(&magazine->backing_allocator, &magazine->cache.stack[magazine->cache.stack_top],
+                                     count);
+}
+
+/**
+ * @brief Fills an empty magazine with up to a batch of objects from the backing allocator.
+ *
+ * @returns The number of objects taken.
+ */
+static size_t pool_magazine_refill(PoolMagazine_t * magazine)
+{
+    // a deinitialised magazine has no cache to fill
+    if (magazine->batch_size == 0) return 0;
+
+    // a full batch is taken in one bulk call, written straight into the empty cache
+    if (i_pool_allocator_allocate_bulk(&magazine->backing_allocator, magazine->cache.stack,
+                                       magazine->batch_size) == ERR_NONE)
+    {
+        magazine->cache.stack_top = magazine->batch_size;
+        return magazine->batch_size;
+    }
+
+    // bulk allocations are all or nothing, so whatever is left of a nearly empty backing allocator is taken singly
+    void * object;
+    size_t refilled = 0;
+    while ((refilled < magazine->batch_size) &&
+           (i_pool_allocator_allocate(&magazine->backing_allocator, &object) == ERR_NONE))
+    {
+        ptr_stack_push(&magazine->cache, object);
+        refilled++;
+    }
+    return refilled;
+}
+
+ErrorCode_t pool_magazine_as_i_pool_allocator(PoolMagazine_t * magazine, IPoolAllocator_t * interface)
+{
+    assert(magazine);
+    assert(interface);
+
+    interface->context = (void *) magazine;
+    interface->allocate = (i_pool_allocate_allocate_t)pool_magazine_allocate;
+    interface->deallocate = (i_pool_allocate_deallocate_t)pool_magazine_deallocate;
+    interface->get_available_count = (i_pool_allocate_get_available_count_t)pool_magazine_get_available_count;
+    interface->allocate_sized = NULL;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
+    return ERR_NONE;
+}
+
+ErrorCode_t pool_magazine_init(PoolMagazine_t * magazine, PoolMagazineConfig_t const * config)
+{
+    assert(magazine);
+    assert(config);
+
+    ErrorCode_t ret = pool_magazine_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    magazine->backing_allocator = *config->backing_allocator;
+    magazine->batch_size = config->batch_size;
+    memset(&magazine->stats, 0, sizeof(magazine->stats));
+
+    return ptr_stack_init(&magazine->cache, config->object_buffer, config->magazine_size);
+}
+
+void pool_magazine_deinit(PoolMagazine_t * magazine)
+{
+    assert(magazine);
+
+    pool_magazine_flush(magazine);
+    ptr_stack_deinit(&magazine->cache);
+    magazine->batch_size = 0;
+}
+
+ErrorCode_t pool_magazine_allocate(PoolMagazine_t * magazine, void ** object_pointer)
+{
+    assert(magazine);
+    assert(object_pointer);
+
+    if (ptr_stack_pop(&magazine->cache, object_pointer) != ERR_NONE)
+    {
+        if (pool_magazine_refill(magazine) == 0) return ERR_NO_MEM;
+        magazine->stats.refill_count++;
+        ptr_stack_pop(&magazine->cache, object_pointer);
+    }
+
+    magazine->stats.allocate_count++;
+    return ERR_NONE;
+}
+
+ErrorCode_t pool_magazine_deallocate(PoolMagazine_t * magazine, void ** object_pointer)
+{
+    assert(magazine);
+    assert(object_pointer);
+
+    if (*object_pointer == NULL) return ERR_OUT_OF_BOUNDS;
+
+    if (ptr_stack_get_remaining_count(&magazine->cache) == 0)
+    {
+        // a deinitialised magazine has no cache, so objects go straight back to the backing allocator
+        if (magazine->batch_size == 0) return i_pool_allocator_deallocate(&magazine->backing_allocator, object_pointer);
+
+        pool_magazine_return_objects(magazine, magazine->batch_size);
+        magazine->stats.flush_count++;
+    }
+
+    ptr_stack_push(&magazine->cache, *object_pointer);
+    *object_pointer = NULL;
+    magazine->stats.deallocate_count++;
+    return ERR_NONE;
+}
+
+void pool_magazine_flush(PoolMagazine_t * magazine)
+{
+    assert(magazine);
+
+    pool_magazine_return_objects(magazine, pool_magazine_get_cached_count(magazine));
+}
+
+size_t pool_magazine_get_available_count(PoolMagazine_t * magazine)
+{
+    assert(magazine);
+
+    return pool_magazine_get_cached_count(magazine) +
+           i_pool_allocator_get_available_count(&magazine->backing_allocator);
+}
+
+size_t pool_magazine_get_cached_count(PoolMagazine_t * magazine)
+{
+    assert(magazine);
+
+    return magazine->cache.max_item_count - ptr_stack_get_remaining_count(&magazine->cache);
+}
+
+void pool_magazine_get_stats(PoolMagazine_t const * magazine, PoolMagazineStats_t * stats)
+{
+    assert(magazine);
+    assert(stats);
+
+    *stats = magazine->stats;
+}
@@ -0,0 +1,176 @@
+#include <cemb/slab_allocator.h>
+
+#include <assert.h>
+
+/**
+ * @brief Rounds an offset up to the region alignment.
+ */
+static inline size_t slab_allocator_align_offset(size_t offset)
+{
+    size_t remainder = offset % SLAB_ALLOCATOR_REGION_ALIGNMENT;
+    return (remainder == 0) ? offset : (offset + SLAB_ALLOCATOR_REGION_ALIGNMENT - remainder);
+}
+
+static ErrorCode_t slab_allocator_validate_config(SlabAllocatorConfig_t const * config)
+{
+    assert(config->buffer);
+    assert(config->size_classes);
+    assert(config->pools);
+    assert(config->lookup_table);
+
+    if (config->size_class_count == 0) return ERR_INVALID_ARG;
+    if (config->size_class_count > SLAB_ALLOCATOR_MAX_SIZE_CLASSES) return ERR_INVALID_ARG;
+
+    size_t offset = 0;
+    size_t previous_size = 0;
+    for (size_t idx = 0; idx < config->size_class_count; ++idx)
+    {
+        SlabSizeClassConfig_t const * size_class = &config->size_classes[idx];
+        if (size_class->object_size <= previous_size) return ERR_INVALID_ARG;
+        if ((size_class->object_size % SLAB_ALLOCATOR_SIZE_GRANULARITY) != 0) return ERR_INVALID_ARG;
+        if (size_class->object_count == 0) return ERR_INVALID_ARG;
+        previous_size = size_class->object_size;
+        offset = slab_allocator_align_offset(offset) + (size_class->object_size * size_class->object_count);
+    }
+
+    if (offset > config->buffer_size) return ERR_INVALID_ARG;
+    if (config->lookup_table_size < SLAB_ALLOCATOR_LOOKUP_TABLE_SIZE(previous_size)) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+/**
+ * @brief Checks if the pointer is within the region of the pool.
+ */
+static inline bool slab_allocator_pool_owns(StaticPool_t const * pool, uint8_t const * object)
+{
+    uint8_t const * region_start = pool->config.buffer;
+    uint8_t const * region_end = &region_start[pool->config.object_size * pool->config.object_count];
+    return (object >= region_start) && (object < region_end);
+}
+
+ErrorCode_t slab_allocator_as_i_pool_allocator(SlabAllocator_t * slab, IPoolAllocator_t * interface)
+{
+    assert(slab);
+    assert(interface);
+
+    interface->context = (void *) slab;
+    interface->allocate = (i_pool_allocate_allocate_t)slab_allocator_allocate;
+    interface->deallocate = (i_pool_allocate_deallocate_t)slab_allocator_deallocate;
+    interface->get_available_count = (i_pool_allocate_get_available_count_t)slab_allocator_get_available_count;
+    interface->allocate_sized = (i_pool_allocate_allocate_sized_t)slab_allocator_allocate_sized;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
+    return ERR_NONE;
+}
+
+ErrorCode_t slab_allocator_init(SlabAllocator_t * slab, SlabAllocatorConfig_t const * config)
+{
+    assert(slab);
+    assert(config);
+
+    ErrorCode_t ret = slab_allocator_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    size_t offset = 0;
+    for (size_t idx = 0; idx < config->size_class_count; ++idx)
+    {
+        SlabSizeClassConfig_t const * size_class = &config->size_classes[idx];
+        size_t region_size = size_class->object_size * size_class->object_count;
+        StaticPoolConfig_t pool_config = {
+            .allocation_stack = size_class->allocation_stack,
+            .buffer = &config->buffer[slab_allocator_align_offset(offset)],
+            .buffer_size = region_size,
+            .object_size = size_class->object_size,
+            .object_count = size_class->object_count,
+        };
+
+        ret = static_pool_init(&config->pools[idx], &pool_config);
+        if (ret != ERR_NONE)
+        {
+            while (idx > 0) static_pool_deinit(&config->pools[--idx]);
+            return ret;
+        }
+        offset = slab_allocator_align_offset(offset) + region_size;
+    }
+
+    // each entry holds the smallest class whose objects fit entry * granularity bytes
+    size_t class_idx = 0;
+    size_t max_object_size = config->size_classes[config->size_class_count - 1].object_size;
+    for (size_t entry = 0; entry < SLAB_ALLOCATOR_LOOKUP_TABLE_SIZE(max_object_size); ++entry)
+    {
+        while (config->size_classes[class_idx].object_size < (entry * SLAB_ALLOCATOR_SIZE_GRANULARITY)) class_idx++;
+        config->lookup_table[entry] = (uint8_t)class_idx;
+    }
+
+    slab->pools = config->pools;
+    slab->size_class_count = config->size_class_count;
+    slab->lookup_table = config->lookup_table;
+    slab->max_object_size = max_object_size;
+
+    return ERR_NONE;
+}
+
+void slab_allocator_deinit(SlabAllocator_t * slab)
+{
+    assert(slab);
+
+    for (size_t idx = 0; idx < slab->size_class_count; ++idx)
+    {
+        static_pool_deinit(&slab->pools[idx]);
+    }
+    // max_object_size is kept so requests after deinit report ERR_NO_MEM, as there are no classes left to search
+    slab->size_class_count = 0;
+}
+
+ErrorCode_t slab_allocator_allocate_sized(SlabAllocator_t * slab, size_t size, void ** object_pointer)
+{
+    assert(slab);
+    assert(object_pointer);
+
+    if (size > slab->max_object_size) return ERR_INVALID_ARG;
+
+    size_t entry = (size + SLAB_ALLOCATOR_SIZE_GRANULARITY - 1) / SLAB_ALLOCATOR_SIZE_GRANULARITY;
+    for (size_t idx = slab->lookup_table[entry]; idx < slab->size_class_count; ++idx)
+    {
+        if (static_pool_allocate(&slab->pools[idx], object_pointer) == ERR_NONE) return ERR_NONE;
+    }
+    return ERR_NO_MEM;
+}
+
+ErrorCode_t slab_allocator_allocate(SlabAllocator_t * slab, void ** object_pointer)
+{
+    assert(slab);
+    assert(object_pointer);
+
+    if (slab->size_class_count == 0) return ERR_NO_MEM;
+    return static_pool_allocate(&slab->pools[slab->size_class_count - 1], object_pointer);
+}
+
+ErrorCode_t slab_allocator_deallocate(SlabAllocator_t * slab, void ** object_pointer)
+{
+    assert(slab);
+    assert(object_pointer);
+
+    if (*object_pointer == NULL) return ERR_OUT_OF_BOUNDS;
+
+    for (size_t idx = 0; idx < slab->size_class_count; ++idx)
+    {
+        if (slab_allocator_pool_owns(&slab->pools[idx], *object_pointer))
+        {
+            return static_pool_deallocate(&slab->pools[idx], object_pointer);
+        }
+    }
+    return ERR_OUT_OF_BOUNDS;
+}
+
+size_t slab_allocator_get_available_count(SlabAllocator_t * slab)
+{
+    assert(slab);
+
+    size_t available_count = 0;
+    for (size_t idx = 0; idx < slab->size_class_count; ++idx)
+    {
+        available_count += static_pool_get_available_count(&slab->pools[idx]);
+    }
+    return available_count;
+}
@@ -3,12 +3,82 @@
 #include <assert.h>
 #include <string.h>
 
+static inline size_t static_pool_get_alignment(StaticPoolConfig_t const * config)
+{
+    return (config->alignment == 0) ? 1 : config->alignment;
+}
+
+static inline size_t static_pool_get_stride(StaticPoolConfig_t const * config)
+{
+    if (config->stride != 0) return config->stride;
+    return STATIC_POOL_STRIDE(config->object_size, static_pool_get_alignment(config));
+}
+
+/**
+ * @brief Gets the number of bytes skipped at the start of the buffer to reach the first alignment boundary.
+ */
+static inline size_t static_pool_get_padding(StaticPoolConfig_t const * config)
+{
+    size_t alignment = static_pool_get_alignment(config);
+    return (alignment - ((uintptr_t)config->buffer & (alignment - 1))) & (alignment - 1);
+}
+
 static inline ErrorCode_t static_pool_validate_config(StaticPoolConfig_t const * config)
 {
     assert(config->buffer);
-    assert(config->allocation_stack);
 
-    if (config->buffer_size < (config->object_size * config->object_count)) return ERR_INVALID_ARG;
+    size_t alignment = static_pool_get_alignment(config);
+    size_t stride = static_pool_get_stride(config);
+
+    if ((alignment & (alignment - 1)) != 0) return ERR_INVALID_ARG;
+    if ((stride < config->object_size) || ((stride & (alignment - 1)) != 0)) return ERR_INVALID_ARG;
+    if (config->buffer_size < static_pool_get_padding(config)) return ERR_INVALID_ARG;
+    if ((config->buffer_size - static_pool_get_padding(config)) < (stride * config->object_count)) return ERR_INVALID_ARG;
+    if ((config->allocation_stack == NULL) && (config->object_size < sizeof(void *))) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+static inline bool static_pool_is_intrusive(StaticPool_t const * pool)
+{
+    return pool->config.allocation_stack == NULL;
+}
+
+static ErrorCode_t static_pool_allocate_intrusive(StaticPool_t * pool, void ** object_pointer)
+{
+    void * object = pool->free_list;
+
+    if (object != NULL)
+    {
+        // objects may not be pointer aligned, so the link is copied rather than dereferenced
+        memcpy(&pool->free_list, object, sizeof(void *));
+    }
+    else if (pool->bump_index < pool->config.object_count)
+    {
+        object = (void *)&pool->objects[pool->bump_index * pool->stride];
+        pool->bump_index++;
+    }
+    else
+    {
+        return ERR_NO_MEM;
+    }
+
+    pool->available_count--;
+    *object_pointer = object;
+    return ERR_NONE;
+}
+
+static ErrorCode_t static_pool_deallocate_intrusive(StaticPool_t * pool, void ** object_pointer)
+{
+    uint8_t * object = *object_pointer;
+
+    if (object < pool->objects) return ERR_OUT_OF_BOUNDS;
+    if (object >= &pool->objects[pool->bump_index * pool->stride]) return ERR_OUT_OF_BOUNDS;
+    if (pool->available_count == pool->config.object_count) return ERR_OUT_OF_BOUNDS;
+
+    memcpy(object, &pool->free_list, sizeof(void *));
+    pool->free_list = object;
+    pool->available_count++;
+    *object_pointer = NULL;
     return ERR_NONE;
 }
 
@@ -21,6 +91,9 @@ ErrorCode_t static_pool_as_i_pool_allocator(StaticPool_t * pool, IPoolAllocator_
     interface->allocate = (i_pool_allocate_allocate_t)static_pool_allocate;
     interface->deallocate = (i_pool_allocate_deallocate_t)static_pool_deallocate;
     interface->get_available_count = (i_pool_allocate_get_available_count_t)static_pool_get_available_count;
+    interface->allocate_sized = NULL;
+    interface->allocate_bulk = (i_pool_allocate_allocate_bulk_t)static_pool_allocate_bulk;
+    interface->deallocate_bulk = (i_pool_allocate_deallocate_bulk_t)static_pool_deallocate_bulk;
     return ERR_NONE;
 }
 
@@ -34,12 +107,23 @@ ErrorCode_t static_pool_init(StaticPool_t * pool, StaticPoolConfig_t const * con
     if (ret != ERR_NONE) return ret;
 
     pool->config = *config;
+    pool->objects = &pool->config.buffer[static_pool_get_padding(config)];
+    pool->stride = static_pool_get_stride(config);
+    pool->free_list = NULL;
+    pool->bump_index = 0;
+    pool->available_count = pool->config.object_count;
+
+    if (static_pool_is_intrusive(pool))
+    {
+        ptr_stack_deinit(&pool->free_stack);
+        return ERR_NONE;
+    }
 
     // no need to check here, the arguments are checked in the validate config for static pool
     ptr_stack_init(&pool->free_stack, pool->config.allocation_stack, pool->config.object_count);
     for (size_t idx = 0; idx < pool->config.object_count; ++idx)
     {
-        ptr_stack_push(&pool->free_stack, (void *)&pool->config.buffer[idx * pool->config.object_size]);
+        ptr_stack_push(&pool->free_stack, (void *)&pool->objects[idx * pool->stride]);
     }
     // initialise all the metadata and other fields
     return ERR_NONE;
@@ -50,6 +134,9 @@ void static_pool_deinit(StaticPool_t * pool)
     assert(pool);
 
     ptr_stack_deinit(&pool->free_stack);
+    pool->free_list = NULL;
+    pool->bump_index = pool->config.object_count;
+    pool->available_count = 0;
 }
 
 ErrorCode_t static_pool_allocate(StaticPool_t * pool, void ** object_pointer)
@@ -57,6 +144,8 @@ ErrorCode_t static_pool_allocate(StaticPool_t * pool, void ** object_pointer)
     assert(pool);
     assert(object_pointer);
 
+    if (static_pool_is_intrusive(pool)) return static_pool_allocate_intrusive(pool, object_pointer);
+
     ErrorCode_t ret;
     void * temp_token = NULL;
 
@@ -77,6 +166,7 @@ ErrorCode_t static_pool_deallocate(StaticPool_t * pool, void ** object_pointer)
     assert(object_pointer);
 
     if (*object_pointer == NULL) return ERR_OUT_OF_BOUNDS;
+    if (static_pool_is_intrusive(pool)) return static_pool_deallocate_intrusive(pool, object_pointer);
 
     // don't need to check, if the stack is full this must have been a bad value, just NULL the pointer and move on. User's responsibility for memory leakages.
     ptr_stack_push(&pool->free_stack, *object_pointer);
@@ -85,9 +175,74 @@ ErrorCode_t static_pool_deallocate(StaticPool_t * pool, void ** object_pointer)
     return ERR_NONE;
 }
 
+ErrorCode_t static_pool_allocate_bulk(StaticPool_t * pool, void ** object_pointers, size_t count)
+{
+    assert(pool);
+    assert(object_pointers);
+
+    if (!static_pool_is_intrusive(pool))
+    {
+        // the free objects are a contiguous run at the top of the stack
+        return (ptr_stack_pop_bulk(&pool->free_stack, object_pointers, count) == ERR_NONE) ? ERR_NONE : ERR_NO_MEM;
+    }
+
+    if (pool->available_count < count) return ERR_NO_MEM;
+    for (size_t idx = 0; idx < count; ++idx)
+    {
+        static_pool_allocate_intrusive(pool, &object_pointers[idx]);
+    }
+    return ERR_NONE;
+}
+
+ErrorCode_t static_pool_deallocate_bulk(StaticPool_t * pool, void ** object_pointers, size_t count)
+{
+    assert(pool);
+    assert(object_pointers);
+
+    ErrorCode_t ret = ERR_NONE;
+
+    if (!static_pool_is_intrusive(pool))
+    {
+        bool all_valid = true;
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            if (object_pointers[idx] == NULL) all_valid = false;
+        }
+        // the whole batch is copied onto the stack in one step when it can be, otherwise each object is freed below
+        if (all_valid && (ptr_stack_push_bulk(&pool->free_stack, object_pointers, count) == ERR_NONE))
+        {
+            memset(object_pointers, 0, count * sizeof(void *));
+            return ERR_NONE;
+        }
+    }
+
+    for (size_t idx = 0; idx < count; ++idx)
+    {
+        // as for a single deallocate, objects that do not fit on the stack must have been bad values
+        ErrorCode_t object_ret = ERR_OUT_OF_BOUNDS;
+        if (object_pointers[idx] == NULL)
+        {
+            // left as out of bounds
+        }
+        else if (static_pool_is_intrusive(pool))
+        {
+            object_ret = static_pool_deallocate_intrusive(pool, &object_pointers[idx]);
+        }
+        else if (ptr_stack_push(&pool->free_stack, object_pointers[idx]) == ERR_NONE)
+        {
+            object_ret = ERR_NONE;
+        }
+        if (ret == ERR_NONE) ret = object_ret;
+        object_pointers[idx] = NULL;
+    }
+    return ret;
+}
+
 size_t static_pool_get_available_count(StaticPool_t * pool)
 {
     assert(pool);
+
+    if (static_pool_is_intrusive(pool)) return pool->available_count;
     // the stack item remaining represents the number of allocated items
     return pool->config.object_count - ptr_stack_get_remaining_count(&pool->free_stack);
 }
\ No newline at end of file
@@ -0,0 +1,420 @@
+#include <cemb/tlsf_allocator.h>
+#include <cemb/bit_ops.h>
+
+#include <assert.h>
+#include <string.h>
+
+#define TLSF_ALLOCATOR_BLOCK_FREE_BIT ((size_t)1)
+#define TLSF_ALLOCATOR_PREV_FREE_BIT ((size_t)2)
+#define TLSF_ALLOCATOR_BLOCK_FLAG_MASK (TLSF_ALLOCATOR_BLOCK_FREE_BIT | TLSF_ALLOCATOR_PREV_FREE_BIT)
+
+/**
+ * Only the size word of a block is overhead on an allocated block, the payload starts straight after it. The overhead
+ * is the gap from the end of one payload to the start of the next, rounded up so every payload stays aligned.
+ */
+#define TLSF_ALLOCATOR_BLOCK_OVERHEAD                                                                                   \
+    (((sizeof(size_t) + TLSF_ALLOCATOR_ALIGN_SIZE - 1) / TLSF_ALLOCATOR_ALIGN_SIZE) * TLSF_ALLOCATOR_ALIGN_SIZE)
+#define TLSF_ALLOCATOR_BLOCK_START_OFFSET (offsetof(TlsfBlock_t, size) + sizeof(size_t))
+
+/**
+ * Bytes at the end of a payload shared with the next block's header, which hold the previous physical pointer.
+ */
+#define TLSF_ALLOCATOR_BLOCK_HEADER_OVERLAP (TLSF_ALLOCATOR_BLOCK_START_OFFSET - TLSF_ALLOCATOR_BLOCK_OVERHEAD)
+
+/**
+ * A free block must hold its free list pointers and the part of the next block's header that overlaps it.
+ */
+#define TLSF_ALLOCATOR_BLOCK_SIZE_MIN (sizeof(TlsfBlock_t) - TLSF_ALLOCATOR_BLOCK_OVERHEAD)
+#define TLSF_ALLOCATOR_BLOCK_SIZE_MAX ((size_t)1 << TLSF_ALLOCATOR_FL_INDEX_MAX)
+#define TLSF_ALLOCATOR_SMALL_BLOCK_SIZE ((size_t)1 << TLSF_ALLOCATOR_FL_INDEX_SHIFT)
+
+_Static_assert((TLSF_ALLOCATOR_ALIGN_SIZE << TLSF_ALLOCATOR_SL_INDEX_COUNT_LOG2) == TLSF_ALLOCATOR_SMALL_BLOCK_SIZE,
+               "small blocks must map one alignment step to each second level list");
+_Static_assert((TLSF_ALLOCATOR_BLOCK_START_OFFSET % TLSF_ALLOCATOR_ALIGN_SIZE) == 0,
+               "payloads must stay aligned");
+_Static_assert(TLSF_ALLOCATOR_BLOCK_START_OFFSET >= TLSF_ALLOCATOR_BLOCK_OVERHEAD,
+               "the next block's header must start at or before the end of a payload");
+_Static_assert((TLSF_ALLOCATOR_BLOCK_HEADER_OVERLAP % TLSF_ALLOCATOR_ALIGN_SIZE) == 0,
+               "payloads after the first must stay aligned");
+_Static_assert((TLSF_ALLOCATOR_BLOCK_SIZE_MIN % TLSF_ALLOCATOR_ALIGN_SIZE) == 0,
+               "the smallest block must keep the next payload aligned");
+
+static inline size_t tlsf_allocator_align_up(size_t value)
+{
+    return (value + (TLSF_ALLOCATOR_ALIGN_SIZE - 1)) & ~((size_t)TLSF_ALLOCATOR_ALIGN_SIZE - 1);
+}
+
+static inline size_t tlsf_allocator_align_down(size_t value)
+{
+    return value & ~((size_t)TLSF_ALLOCATOR_ALIGN_SIZE - 1);
+}
+
+static inline size_t tlsf_allocator_block_size(TlsfBlock_t const * block)
+{
+    return block->size & ~TLSF_ALLOCATOR_BLOCK_FLAG_MASK;
+}
+
+static inline void tlsf_allocator_block_set_size(TlsfBlock_t * block, size_t size)
+{
+    block->size = size | (block->size & TLSF_ALLOCATOR_BLOCK_FLAG_MASK);
+}
+
+static inline bool tlsf_allocator_block_is_free(TlsfBlock_t const * block)
+{
+    return (block->size & TLSF_ALLOCATOR_BLOCK_FREE_BIT) != 0;
+}
+
+static inline bool tlsf_allocator_block_is_prev_free(TlsfBlock_t const * block)
+{
+    return (block->size & TLSF_ALLOCATOR_PREV_FREE_BIT) != 0;
+}
+
+static inline void tlsf_allocator_block_set_flag(TlsfBlock_t * block, size_t flag, bool set)
+{
+    block->size = set ? (block->size | flag) : (block->size & ~flag);
+}
+
+static inline void * tlsf_allocator_block_to_payload(TlsfBlock_t const * block)
+{
+    return (void *)((uint8_t *)block + TLSF_ALLOCATOR_BLOCK_START_OFFSET);
+}
+
+static inline TlsfBlock_t * tlsf_allocator_payload_to_block(void const * payload)
+{
+    return (TlsfBlock_t *)((uint8_t *)payload - TLSF_ALLOCATOR_BLOCK_START_OFFSET);
+}
+
+/**
+ * @brief Gets the next physical block, whose header overlaps the end of this block's payload.
+ */
+static inline TlsfBlock_t * tlsf_allocator_block_next(TlsfBlock_t const * block)
+{
+    uint8_t * payload = tlsf_allocator_block_to_payload(block);
+    return (TlsfBlock_t *)(payload + tlsf_allocator_block_size(block) - TLSF_ALLOCATOR_BLOCK_HEADER_OVERLAP);
+}
+
+/**
+ * @brief Records this block in the next physical block, and returns the next block.
+ */
+static inline TlsfBlock_t * tlsf_allocator_block_link_next(TlsfBlock_t * block)
+{
+    TlsfBlock_t * next = tlsf_allocator_block_next(block);
+    next->prev_physical = block;
+    return next;
+}
+
+/**
+ * @brief Gets the lists a block of this size belongs in.
+ */
+static void tlsf_allocator_mapping_insert(size_t size, size_t * fl, size_t * sl)
+{
+    if (size < TLSF_ALLOCATOR_SMALL_BLOCK_SIZE)
+    {
+        *fl = 0;
+        *sl = size / (TLSF_ALLOCATOR_SMALL_BLOCK_SIZE / TLSF_ALLOCATOR_SL_INDEX_COUNT);
+    }
+    else
+    {
+        size_t top_bit = bit_ops_find_last_set_u32((uint32_t)size) - 1;
+        *sl = (size >> (top_bit - TLSF_ALLOCATOR_SL_INDEX_COUNT_LOG2)) ^ ((size_t)1 << TLSF_ALLOCATOR_SL_INDEX_COUNT_LOG2);
+        *fl = top_bit - (TLSF_ALLOCATOR_FL_INDEX_SHIFT - 1);
+    }
+}
+
+/**
+ * @brief Gets the first lists where every block is at least this size, by rounding up to the next list boundary.
+ */
+static void tlsf_allocator_mapping_search(size_t size, size_t * fl, size_t * sl)
+{
+    if (size >= TLSF_ALLOCATOR_SMALL_BLOCK_SIZE)
+    {
+        size_t top_bit = bit_ops_find_last_set_u32((uint32_t)size) - 1;
+        size += ((size_t)1 << (top_bit - TLSF_ALLOCATOR_SL_INDEX_COUNT_LOG2)) - 1;
+    }
+    tlsf_allocator_mapping_insert(size, fl, sl);
+}
+
+static void tlsf_allocator_insert_free_block(TlsfAllocator_t * tlsf, TlsfBlock_t * block)
+{
+    size_t fl;
+    size_t sl;
+    tlsf_allocator_mapping_insert(tlsf_allocator_block_size(block), &fl, &sl);
+
+    TlsfBlock_t * head = tlsf->free_lists[fl][sl];
+    block->next_free = head;
+    block->prev_free = NULL;
+    if (head != NULL) head->prev_free = block;
+    tlsf->free_lists[fl][sl] = block;
+
+    tlsf->fl_bitmap |= ((uint32_t)1 << fl);
+    tlsf->sl_bitmap[fl] |= ((uint32_t)1 << sl);
+    tlsf->free_bytes += tlsf_allocator_block_size(block);
+}
+
+static void tlsf_allocator_remove_free_block(TlsfAllocator_t * tlsf, TlsfBlock_t * block)
+{
+    size_t fl;
+    size_t sl;
+    tlsf_allocator_mapping_insert(tlsf_allocator_block_size(block), &fl, &sl);
+
+    if (block->next_free != NULL) block->next_free->prev_free = block->prev_free;
+    if (block->prev_free != NULL)
+    {
+        block->prev_free->next_free = block->next_free;
+    }
+    else
+    {
+        tlsf->free_lists[fl][sl] = block->next_free;
+        if (block->next_free == NULL)
+        {
+            tlsf->sl_bitmap[fl] &= ~((uint32_t)1 << sl);
+            if (tlsf->sl_bitmap[fl] == 0) tlsf->fl_bitmap &= ~((uint32_t)1 << fl);
+        }
+    }
+    tlsf->free_bytes -= tlsf_allocator_block_size(block);
+}
+
+/**
+ * @brief Finds a free block in the first non empty list at or above the given lists.
+ */
+static TlsfBlock_t * tlsf_allocator_find_suitable_block(TlsfAllocator_t const * tlsf, size_t fl, size_t sl)
+{
+    if (fl >= TLSF_ALLOCATOR_FL_INDEX_COUNT) return NULL;
+
+    uint32_t sl_map = tlsf->sl_bitmap[fl] & (UINT32_MAX << sl);
+    if (sl_map == 0)
+    {
+        // no list in this size range, so take the smallest list of the next non empty range
+        uint32_t fl_map = tlsf->fl_bitmap & (UINT32_MAX << (fl + 1));
+        if (fl_map == 0) return NULL;
+
+        fl = bit_ops_count_trailing_zeros_u32(fl_map);
+        sl_map = tlsf->sl_bitmap[fl];
+    }
+
+    sl = bit_ops_count_trailing_zeros_u32(sl_map);
+    return tlsf->free_lists[fl][sl];
+}
+
+/**
+ * @brief Marks a block as free in its own flags and in the next block's flags.
+ */
+static void tlsf_allocator_block_mark_free(TlsfBlock_t * block)
+{
+    TlsfBlock_t * next = tlsf_allocator_block_link_next(block);
+    tlsf_allocator_block_set_flag(next, TLSF_ALLOCATOR_PREV_FREE_BIT, true);
+    tlsf_allocator_block_set_flag(block, TLSF_ALLOCATOR_BLOCK_FREE_BIT, true);
+}
+
+static void tlsf_allocator_block_mark_used(TlsfBlock_t * block)
+{
+    TlsfBlock_t * next = tlsf_allocator_block_next(block);
+    tlsf_allocator_block_set_flag(next, TLSF_ALLOCATOR_PREV_FREE_BIT, false);
+    tlsf_allocator_block_set_flag(block, TLSF_ALLOCATOR_BLOCK_FREE_BIT, false);
+}
+
+/**
+ * @brief Splits the tail off a block being allocated, if the tail is big enough to be a block itself.
+ */
+static void tlsf_allocator_trim_free(TlsfAllocator_t * tlsf, TlsfBlock_t * block, size_t size)
+{
+    if (tlsf_allocator_block_size(block) < (size + TLSF_ALLOCATOR_BLOCK_OVERHEAD + TLSF_ALLOCATOR_BLOCK_SIZE_MIN)) return;
+
+    uint8_t * payload = tlsf_allocator_block_to_payload(block);
+    TlsfBlock_t * remaining = (TlsfBlock_t *)(payload + size - TLSF_ALLOCATOR_BLOCK_HEADER_OVERLAP);
+    size_t remaining_size = tlsf_allocator_block_size(block) - (size + TLSF_ALLOCATOR_BLOCK_OVERHEAD);
+
+    remaining->size = 0;
+    tlsf_allocator_block_set_size(remaining, remaining_size);
+    tlsf_allocator_block_set_size(block, size);
+    tlsf_allocator_block_link_next(block);
+    tlsf_allocator_block_mark_free(remaining);
+    tlsf_allocator_insert_free_block(tlsf, remaining);
+}
+
+/**
+ * @brief Merges the second block into the first, which must be its previous physical block.
+ */
+static TlsfBlock_t * tlsf_allocator_block_absorb(TlsfBlock_t * previous, TlsfBlock_t * block)
+{
+    size_t size = tlsf_allocator_block_size(previous) + tlsf_allocator_block_size(block) + TLSF_ALLOCATOR_BLOCK_OVERHEAD;
+    tlsf_allocator_block_set_size(previous, size);
+    tlsf_allocator_block_link_next(previous);
+    return previous;
+}
+
+static ErrorCode_t tlsf_allocator_allocate_unsized(TlsfAllocator_t * tlsf, void ** object_pointer)
+{
+    assert(tlsf);
+    assert(object_pointer);
+
+    if (tlsf->default_size == 0) return ERR_NOT_IMPLEMENTED;
+    return tlsf_allocator_allocate(tlsf, tlsf->default_size, object_pointer);
+}
+
+static ErrorCode_t tlsf_allocator_validate_config(TlsfAllocatorConfig_t const * config)
+{
+    assert(config->buffer);
+
+    if (((uintptr_t)config->buffer % TLSF_ALLOCATOR_ALIGN_SIZE) != 0) return ERR_INVALID_ARG;
+    if (config->buffer_size >= TLSF_ALLOCATOR_BLOCK_SIZE_MAX) return ERR_INVALID_ARG;
+
+    // the first block's header and the end sentinel's size word surround the free space
+    size_t overhead = TLSF_ALLOCATOR_BLOCK_START_OFFSET + TLSF_ALLOCATOR_BLOCK_OVERHEAD;
+    if (config->buffer_size < (overhead + TLSF_ALLOCATOR_BLOCK_SIZE_MIN)) return ERR_INVALID_ARG;
+    return ERR_NONE;
+}
+
+ErrorCode_t tlsf_allocator_as_i_pool_allocator(TlsfAllocator_t * tlsf, IPoolAllocator_t * interface)
+{
+    assert(tlsf);
+    assert(interface);
+
+    interface->context = (void *) tlsf;
+    interface->allocate = (i_pool_allocate_allocate_t)tlsf_allocator_allocate_unsized;
+    interface->deallocate = (i_pool_allocate_deallocate_t)tlsf_allocator_deallocate;
+    interface->get_available_count = (i_pool_allocate_get_available_count_t)tlsf_allocator_get_free_bytes;
+    interface->allocate_sized = (i_pool_allocate_allocate_sized_t)tlsf_allocator_allocate;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
+    return ERR_NONE;
+}
+
+ErrorCode_t tlsf_allocator_init(TlsfAllocator_t * tlsf, TlsfAllocatorConfig_t const * config)
+{
+    assert(tlsf);
+    assert(config);
+
+    ErrorCode_t ret = tlsf_allocator_validate_config(config);
+    if (ret != ERR_NONE) return ret;
+
+    tlsf->buffer = config->buffer;
+    tlsf->buffer_size = config->buffer_size;
+    tlsf->free_bytes = 0;
+    tlsf->default_size = config->default_size;
+    tlsf->fl_bitmap = 0;
+    memset(tlsf->sl_bitmap, 0, sizeof(tlsf->sl_bitmap));
+    memset(tlsf->free_lists, 0, sizeof(tlsf->free_lists));
+
+    size_t overhead = TLSF_ALLOCATOR_BLOCK_START_OFFSET + TLSF_ALLOCATOR_BLOCK_OVERHEAD;
+    TlsfBlock_t * block = (TlsfBlock_t *)config->buffer;
+    block->size = 0;
+    tlsf_allocator_block_set_size(block, tlsf_allocator_align_down(config->buffer_size - overhead));
+
+    // a zero sized, allocated sentinel ends the buffer so merging never looks past it
+    TlsfBlock_t * sentinel = tlsf_allocator_block_next(block);
+    sentinel->size = 0;
+    tlsf_allocator_block_mark_free(block);
+    tlsf_allocator_insert_free_block(tlsf, block);
+
+    return ERR_NONE;
+}
+
+void tlsf_allocator_deinit(TlsfAllocator_t * tlsf)
+{
+    assert(tlsf);
+
+    tlsf->buffer = NULL;
+    tlsf->buffer_size = 0;
+    tlsf->free_bytes = 0;
+    tlsf->default_size = 0;
+    tlsf->fl_bitmap = 0;
+    memset(tlsf->sl_bitmap, 0, sizeof(tlsf->sl_bitmap));
+}
+
+ErrorCode_t tlsf_allocator_allocate(TlsfAllocator_t * tlsf, size_t size, void ** object_pointer)
+{
+    assert(tlsf);
+    assert(object_pointer);
+
+    if ((size == 0) || (size >= TLSF_ALLOCATOR_BLOCK_SIZE_MAX)) return ERR_INVALID_ARG;
+
+    size = tlsf_allocator_align_up(size);
+    if (size < TLSF_ALLOCATOR_BLOCK_SIZE_MIN) size = TLSF_ALLOCATOR_BLOCK_SIZE_MIN;
+
+    size_t fl;
+    size_t sl;
+    tlsf_allocator_mapping_search(size, &fl, &sl);
+    TlsfBlock_t * block = tlsf_allocator_find_suitable_block(tlsf, fl, sl);
+    if (block == NULL) return ERR_NO_MEM;
+
+    tlsf_allocator_remove_free_block(tlsf, block);
+    tlsf_allocator_trim_free(tlsf, block, size);
+    tlsf_allocator_block_mark_used(block);
+
+    *object_pointer = tlsf_allocator_block_to_payload(block);
+    return ERR_NONE;
+}
+
+ErrorCode_t tlsf_allocator_deallocate(TlsfAllocator_t * tlsf, void ** object_pointer)
+{
+    assert(tlsf);
+    assert(object_pointer);
+
+    uint8_t * payload = *object_pointer;
+    if (payload == NULL) return ERR_OUT_OF_BOUNDS;
+    if (payload < (tlsf->buffer + TLSF_ALLOCATOR_BLOCK_START_OFFSET)) return ERR_OUT_OF_BOUNDS;
+    if (payload >= (tlsf->buffer + tlsf->buffer_size)) return ERR_OUT_OF_BOUNDS;
+
+    TlsfBlock_t * block = tlsf_allocator_payload_to_block(payload);
+    if (tlsf_allocator_block_is_free(block)) return ERR_INVALID_STATE;
+
+    tlsf_allocator_block_mark_free(block);
+
+    if (tlsf_allocator_block_is_prev_free(block))
+    {
+        TlsfBlock_t * previous = block->prev_physical;
+        tlsf_allocator_remove_free_block(tlsf, previous);
+        block = tlsf_allocator_block_absorb(previous, block);
+    }
+
+    TlsfBlock_t * next = tlsf_allocator_block_next(block);
+    if (tlsf_allocator_block_is_free(next))
+    {
+        tlsf_allocator_remove_free_block(tlsf, next);
+        block = tlsf_allocator_block_absorb(block, next);
+    }
+
+    tlsf_allocator_insert_free_block(tlsf, block);
+    *object_pointer = NULL;
+    return ERR_NONE;
+}
+
+size_t tlsf_allocator_get_free_bytes(TlsfAllocator_t * tlsf)
+{
+    assert(tlsf);
+
+    return tlsf->free_bytes;
+}
+
+void tlsf_allocator_get_stats(TlsfAllocator_t const * tlsf, TlsfAllocatorStats_t * stats)
+{
+    assert(tlsf);
+    assert(stats);
+
+    memset(stats, 0, sizeof(*stats));
+    if (tlsf->buffer == NULL) return;
+
+    // the sentinel is the only zero sized block
+    for (TlsfBlock_t * block = (TlsfBlock_t *)tlsf->buffer; tlsf_allocator_block_size(block) != 0;
+         block = tlsf_allocator_block_next(block))
+    {
+        size_t size = tlsf_allocator_block_size(block);
+        if (tlsf_allocator_block_is_free(block))
+        {
+            stats->free_bytes += size;
+            stats->free_block_count++;
+            if (size > stats->largest_free_block) stats->largest_free_block = size;
+        }
+        else
+        {
+            stats->used_bytes += size;
+            stats->used_block_count++;
+        }
+    }
+
+    if (stats->free_bytes > 0)
+    {
+        stats->fragmentation_percent = (uint32_t)(100u - ((stats->largest_free_block * 100u) / stats->free_bytes));
+    }
+}
@@ -1,5 +1,7 @@
 #include <cemb/bit_ops.h>
 
+#include <limits.h>
+
 /**
  * We use the implmentation observed here. This will optimise to the intrinsic machine instruction if available (apparently).
  * @see https://stackoverflow.com/a/109025
@@ -10,4 +12,57 @@ uint32_t bit_ops_hamming_weight_u32(uint32_t i)
     i = (i & 0x33333333) + ((i >> 2) & 0x33333333);  // quads
     i = (i + (i >> 4)) & 0x0F0F0F0F;        // groups of 8
     return (i * 0x01010101) >> 24;          // horizontal sum of bytes
-}
\ No newline at end of file
+}
+
+/**
+ * Uses the compiler intrinsic when available, which is a single instruction on most targets. Targets with a 16 bit int
+ * use the unsigned long intrinsic, as the unsigned int one would truncate the value. Otherwise the lowest set bit is
+ * isolated and multiplied by a de Bruijn sequence, so the top 5 bits index a table of positions.
+ * @see http://supertech.csail.mit.edu/papers/debruijn.pdf
+ */
+uint32_t bit_ops_count_trailing_zeros_u32(uint32_t i)
+{
+    if (i == 0) return 32;
+#if defined(__GNUC__) || defined(__clang__)
+#if UINT_MAX >= 0xFFFFFFFFu
+    return (uint32_t)__builtin_ctz(i);
+#else
+    return (uint32_t)__builtin_ctzl(i);
+#endif
+#else
+    static uint8_t const de_bruijn_positions[32] = {
+        0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+    };
+    return de_bruijn_positions[((i & (0u - i)) * 0x077CB531u) >> 27];
+#endif
+}
+
+uint32_t bit_ops_find_first_set_u32(uint32_t i)
+{
+    return (i == 0) ? 0 : (bit_ops_count_trailing_zeros_u32(i) + 1);
+}
+
+/**
+ * The intrinsic counts leading zeros from the top of the type it takes, which is chosen as for the trailing zeros.
+ * Without the intrinsic, the highest bit is smeared into every lower bit, leaving a value whose hamming weight is the
+ * position of the highest bit.
+ */
+uint32_t bit_ops_find_last_set_u32(uint32_t i)
+{
+    if (i == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+#if UINT_MAX >= 0xFFFFFFFFu
+    return (uint32_t)(sizeof(unsigned int) * CHAR_BIT) - (uint32_t)__builtin_clz(i);
+#else
+    return (uint32_t)(sizeof(unsigned long) * CHAR_BIT) - (uint32_t)__builtin_clzl(i);
+#endif
+#else
+    i |= i >> 1;
+    i |= i >> 2;
+    i |= i >> 4;
+    i |= i >> 8;
+    i |= i >> 16;
+    return bit_ops_hamming_weight_u32(i);
+#endif
+}
@@ -13,6 +13,9 @@ void mock_pool_allocator_get_interface(IPoolAllocator_t * interface, void * cont
     interface->allocate = (i_pool_allocate_allocate_t)mock_pool_allocator_allocate;
     interface->deallocate = (i_pool_allocate_deallocate_t)mock_pool_allocator_deallocate;
     interface->get_available_count = (i_pool_allocate_get_available_count_t)mock_pool_allocator_get_unused_count;
+    interface->allocate_sized = NULL;
+    interface->allocate_bulk = NULL;
+    interface->deallocate_bulk = NULL;
 }
 
 ErrorCode_t mock_pool_allocator_allocate(void * pool, void ** object_pointer)
@@ -0,0 +1,343 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/arena.h>
+#include <cemb/static_pool.h>
+#include "test_arena.h"
+
+#define TEST_BUFFER_SIZE (64)
+#define TEST_BLOCK_SIZE (64)
+#define TEST_BLOCK_COUNT (2)
+
+typedef struct TestArenaFixture TestArenaFixture_t;
+
+/**
+ * @brief The arena's buffer, and a static pool of blocks for chaining.
+ */
+struct TestArenaFixture
+{
+    _Alignas(max_align_t) uint8_t buffer[TEST_BUFFER_SIZE];
+    _Alignas(max_align_t) uint8_t block_buffer[TEST_BLOCK_SIZE * TEST_BLOCK_COUNT];
+    void * allocation_stack[TEST_BLOCK_COUNT];
+    StaticPool_t pool;
+    IPoolAllocator_t pool_allocator;
+};
+
+static ArenaConfig_t test_get_config(TestArenaFixture_t * fixture)
+{
+    StaticPoolConfig_t pool_config = {
+        .buffer = fixture->block_buffer,
+        .buffer_size = sizeof(fixture->block_buffer),
+        .allocation_stack = fixture->allocation_stack,
+        .object_count = TEST_BLOCK_COUNT,
+        .object_size = TEST_BLOCK_SIZE,
+    };
+
+    assert_int_equal(ERR_NONE, static_pool_init(&fixture->pool, &pool_config));
+    assert_int_equal(ERR_NONE, static_pool_as_i_pool_allocator(&fixture->pool, &fixture->pool_allocator));
+
+    ArenaConfig_t config = {
+        .buffer = fixture->buffer,
+        .buffer_size = sizeof(fixture->buffer),
+        .block_allocator = NULL,
+        .block_size = 0,
+    };
+    return config;
+}
+
+static void test_invalid_configs(void ** state)
+{
+    (void)state;
+
+    TestArenaFixture_t fixture;
+    ArenaConfig_t config = test_get_config(&fixture);
+    ArenaConfig_t test_config;
+    Arena_t arena;
+    ErrorCode_t ret;
+
+    test_config = config;
+    test_config.buffer_size = 0;
+    ret = arena_init(&arena, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.block_allocator = &fixture.pool_allocator;
+    test_config.block_size = sizeof(ArenaBlock_t);
+    ret = arena_init(&arena, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+}
+
+static void test_aligned_bump_allocation(void ** state)
+{
+    (void)state;
+
+    TestArenaFixture_t fixture;
+    ArenaConfig_t config = test_get_config(&fixture);
+    Arena_t arena;
+    void * object = NULL;
+    void * previous = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, arena_init(&arena, &config));
+    assert_int_equal(TEST_BUFFER_SIZE, arena_get_remaining(&arena));
+
+    ret = arena_allocate(&arena, 1, 3, &object);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    // allocations follow each other, with padding only where the alignment needs it
+    ret = arena_allocate(&arena, 3, 1, &previous);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(fixture.buffer, previous);
+
+    ret = arena_allocate(&arena, 8, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&fixture.buffer[8], object);
+    assert_int_equal(TEST_BUFFER_SIZE - 16, arena_get_remaining(&arena));
+
+    ret = arena_allocate(&arena, 1, 1, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&fixture.buffer[16], object);
+
+    ret = arena_allocate(&arena, 16, 16, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&fixture.buffer[32], object);
+
+    // exactly the remaining bytes fit, one more does not
+    ret = arena_allocate(&arena, 17, 1, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    ret = arena_allocate(&arena, 16, 1, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(0, arena_get_remaining(&arena));
+
+    arena_reset(&arena);
+    assert_int_equal(TEST_BUFFER_SIZE, arena_get_remaining(&arena));
+    ret = arena_allocate(&arena, 3, 1, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(previous, object);
+
+    arena_deinit(&arena);
+
+    ret = arena_allocate(&arena, 1, 1, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, arena_get_remaining(&arena));
+}
+
+static void test_nested_marks(void ** state)
+{
+    (void)state;
+
+    TestArenaFixture_t fixture;
+    ArenaConfig_t config = test_get_config(&fixture);
+    Arena_t arena;
+    ArenaMark_t outer;
+    ArenaMark_t inner;
+    void * object = NULL;
+    void * inner_object = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, arena_init(&arena, &config));
+
+    ret = arena_allocate(&arena, 8, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+
+    arena_mark(&arena, &outer);
+    ret = arena_allocate(&arena, 8, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+
+    arena_mark(&arena, &inner);
+    ret = arena_allocate(&arena, 8, 8, &inner_object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 24, arena_get_remaining(&arena));
+
+    ret = arena_reset_to_mark(&arena, &inner);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 16, arena_get_remaining(&arena));
+
+    // the space released by the mark is reused
+    ret = arena_allocate(&arena, 8, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(inner_object, object);
+
+    ret = arena_reset_to_mark(&arena, &outer);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 8, arena_get_remaining(&arena));
+
+    // the inner mark now points past the current position
+    ret = arena_reset_to_mark(&arena, &inner);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 8, arena_get_remaining(&arena));
+
+    arena_deinit(&arena);
+}
+
+static void test_stale_marks(void ** state)
+{
+    (void)state;
+
+    TestArenaFixture_t fixture;
+    ArenaConfig_t config = test_get_config(&fixture);
+    Arena_t arena;
+    ArenaMark_t outer;
+    ArenaMark_t inner;
+    void * object = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, arena_init(&arena, &config));
+
+    ret = arena_allocate(&arena, 16, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    arena_mark(&arena, &outer);
+
+    ret = arena_allocate(&arena, 16, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    arena_mark(&arena, &inner);
+
+    ret = arena_reset_to_mark(&arena, &outer);
+    assert_int_equal(ERR_NONE, ret);
+
+    // the inner mark is back behind the current position, but inside an allocation made after the reset
+    ret = arena_allocate(&arena, 32, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 48, arena_get_remaining(&arena));
+
+    ret = arena_reset_to_mark(&arena, &inner);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 48, arena_get_remaining(&arena));
+
+    // the outer mark can be returned to as often as needed
+    ret = arena_reset_to_mark(&arena, &outer);
+    assert_int_equal(ERR_NONE, ret);
+    ret = arena_allocate(&arena, 8, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    ret = arena_reset_to_mark(&arena, &outer);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 16, arena_get_remaining(&arena));
+
+    arena_reset(&arena);
+    ret = arena_reset_to_mark(&arena, &outer);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    arena_deinit(&arena);
+}
+
+static void test_stale_mark_in_reused_block(void ** state)
+{
+    (void)state;
+
+    TestArenaFixture_t fixture;
+    ArenaConfig_t config = test_get_config(&fixture);
+    Arena_t arena;
+    ArenaMark_t mark;
+    ArenaMark_t chained_mark;
+    void * object = NULL;
+    void * chained_object = NULL;
+    ErrorCode_t ret;
+
+    config.block_allocator = &fixture.pool_allocator;
+    config.block_size = TEST_BLOCK_SIZE;
+    assert_int_equal(ERR_NONE, arena_init(&arena, &config));
+
+    ret = arena_allocate(&arena, 48, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    arena_mark(&arena, &mark);
+
+    ret = arena_allocate(&arena, 32, 8, &chained_object);
+    assert_int_equal(ERR_NONE, ret);
+    arena_mark(&arena, &chained_mark);
+
+    ret = arena_reset_to_mark(&arena, &mark);
+    assert_int_equal(ERR_NONE, ret);
+
+    // the released block is chained again at the same address, and filled past the old mark
+    ret = arena_allocate(&arena, 32, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(chained_object, object);
+    ret = arena_allocate(&arena, 16, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+
+    ret = arena_reset_to_mark(&arena, &chained_mark);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+    assert_int_equal(1, static_pool_get_available_count(&fixture.pool));
+
+    arena_deinit(&arena);
+    assert_int_equal(TEST_BLOCK_COUNT, static_pool_get_available_count(&fixture.pool));
+}
+
+static void test_chained_blocks(void ** state)
+{
+    (void)state;
+
+    TestArenaFixture_t fixture;
+    ArenaConfig_t config = test_get_config(&fixture);
+    Arena_t arena;
+    ArenaMark_t mark;
+    ArenaMark_t chained_mark;
+    void * object = NULL;
+    ErrorCode_t ret;
+
+    config.block_allocator = &fixture.pool_allocator;
+    config.block_size = TEST_BLOCK_SIZE;
+    assert_int_equal(ERR_NONE, arena_init(&arena, &config));
+
+    ret = arena_allocate(&arena, 48, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    arena_mark(&arena, &mark);
+
+    // the buffer is full, so the next allocation starts a block after its header
+    ret = arena_allocate(&arena, 32, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_true((uint8_t *)object >= &fixture.block_buffer[sizeof(ArenaBlock_t)]);
+    assert_true((uint8_t *)object < &fixture.block_buffer[sizeof(fixture.block_buffer)]);
+    assert_int_equal(1, static_pool_get_available_count(&fixture.pool));
+
+    arena_mark(&arena, &chained_mark);
+    ret = arena_allocate(&arena, 32, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(0, static_pool_get_available_count(&fixture.pool));
+
+    // every block is in use
+    ret = arena_allocate(&arena, TEST_BLOCK_SIZE, 8, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, static_pool_get_available_count(&fixture.pool));
+
+    ret = arena_reset_to_mark(&arena, &chained_mark);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(1, static_pool_get_available_count(&fixture.pool));
+
+    // larger than a block can ever hold, the block taken for it is given back
+    ret = arena_allocate(&arena, TEST_BLOCK_SIZE, 8, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(1, static_pool_get_available_count(&fixture.pool));
+
+    ret = arena_reset_to_mark(&arena, &mark);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BLOCK_COUNT, static_pool_get_available_count(&fixture.pool));
+    assert_int_equal(TEST_BUFFER_SIZE - 48, arena_get_remaining(&arena));
+
+    // the chained mark's block has been released
+    ret = arena_reset_to_mark(&arena, &chained_mark);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    ret = arena_allocate(&arena, 32, 8, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(1, static_pool_get_available_count(&fixture.pool));
+
+    arena_deinit(&arena);
+    assert_int_equal(TEST_BLOCK_COUNT, static_pool_get_available_count(&fixture.pool));
+}
+
+int test_arena_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_invalid_configs),
+        cmocka_unit_test(test_aligned_bump_allocation),
+        cmocka_unit_test(test_nested_marks),
+        cmocka_unit_test(test_stale_marks),
+        cmocka_unit_test(test_stale_mark_in_reused_block),
+        cmocka_unit_test(test_chained_blocks),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
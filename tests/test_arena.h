@@ -0,0 +1,3 @@
+#pragma once
+
+int test_arena_run_tests(void);
@@ -22,10 +22,53 @@ static void test_hamming_weight(void ** state)
     assert_int_equal(5, bit_ops_hamming_weight_u32(weight_5));
 }
 
+static void test_count_trailing_zeros(void ** state)
+{
+    (void)state;
+
+    assert_int_equal(32, bit_ops_count_trailing_zeros_u32(0));
+    assert_int_equal(0, bit_ops_count_trailing_zeros_u32(1));
+    assert_int_equal(2, bit_ops_count_trailing_zeros_u32(0x1C));
+    assert_int_equal(31, bit_ops_count_trailing_zeros_u32(0x80000000));
+
+    for (uint32_t bit = 0; bit < 32; ++bit)
+    {
+        assert_int_equal(bit, bit_ops_count_trailing_zeros_u32(UINT32_MAX << bit));
+    }
+}
+
+static void test_find_first_set(void ** state)
+{
+    (void)state;
+
+    assert_int_equal(0, bit_ops_find_first_set_u32(0));
+    assert_int_equal(1, bit_ops_find_first_set_u32(1));
+    assert_int_equal(3, bit_ops_find_first_set_u32(0x1C));
+    assert_int_equal(32, bit_ops_find_first_set_u32(0x80000000));
+}
+
+static void test_find_last_set(void ** state)
+{
+    (void)state;
+
+    assert_int_equal(0, bit_ops_find_last_set_u32(0));
+    assert_int_equal(1, bit_ops_find_last_set_u32(1));
+    assert_int_equal(5, bit_ops_find_last_set_u32(0x1C));
+    assert_int_equal(32, bit_ops_find_last_set_u32(0x80000001));
+
+    for (uint32_t bit = 0; bit < 32; ++bit)
+    {
+        assert_int_equal(bit + 1, bit_ops_find_last_set_u32(UINT32_MAX >> (31 - bit)));
+    }
+}
+
 int test_bit_ops_run_tests(void)
 {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_hamming_weight),
+        cmocka_unit_test(test_count_trailing_zeros),
+        cmocka_unit_test(test_find_first_set),
+        cmocka_unit_test(test_find_last_set),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/bitmap_pool.h>
+#include "test_bitmap_pool.h"
+
+// spans two bitmap words, with the second only partly used
+#define TEST_OBJECT_COUNT (40)
+#define TEST_OBJECT_SIZE_BYTES (12)
+
+static void test_init_pool(BitmapPool_t * pool, uint8_t * buffer, uint32_t * bitmap)
+{
+    BitmapPoolConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT,
+        .object_size = TEST_OBJECT_SIZE_BYTES,
+        .object_count = TEST_OBJECT_COUNT,
+        .bitmap = bitmap,
+        .bitmap_word_count = BITMAP_POOL_BITMAP_WORD_COUNT(TEST_OBJECT_COUNT),
+    };
+
+    ErrorCode_t ret = bitmap_pool_init(pool, &config);
+    assert_int_equal(ERR_NONE, ret);
+}
+
+static void test_correct_interface(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT];
+    static uint32_t bitmap[BITMAP_POOL_BITMAP_WORD_COUNT(TEST_OBJECT_COUNT)];
+    BitmapPool_t pool;
+    IPoolAllocator_t interface;
+
+    test_init_pool(&pool, buffer, bitmap);
+
+    ErrorCode_t ret = bitmap_pool_as_i_pool_allocator(&pool, &interface);
+    assert_int_equal(ERR_NONE, ret);
+
+    assert_ptr_equal(interface.context, &pool);
+    assert_ptr_equal(interface.allocate, bitmap_pool_allocate);
+    assert_ptr_equal(interface.deallocate, bitmap_pool_deallocate);
+    assert_ptr_equal(interface.get_available_count, bitmap_pool_get_available_count);
+    assert_ptr_equal(NULL, interface.allocate_sized);
+}
+
+static void test_invalid_configs(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT];
+    static uint32_t bitmap[BITMAP_POOL_BITMAP_WORD_COUNT(TEST_OBJECT_COUNT)];
+    BitmapPoolConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = TEST_OBJECT_SIZE_BYTES,
+        .object_count = TEST_OBJECT_COUNT,
+        .bitmap = bitmap,
+        .bitmap_word_count = BITMAP_POOL_BITMAP_WORD_COUNT(TEST_OBJECT_COUNT),
+    };
+    BitmapPoolConfig_t test_config;
+    BitmapPool_t pool;
+    ErrorCode_t ret;
+
+    test_config = config;
+    test_config.buffer_size = sizeof(buffer) - 1;
+    ret = bitmap_pool_init(&pool, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.bitmap_word_count = 1;
+    ret = bitmap_pool_init(&pool, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.object_count = 0;
+    ret = bitmap_pool_init(&pool, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+}
+
+static void test_allocation_fills_and_unfills_correctly(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT];
+    static uint32_t bitmap[BITMAP_POOL_BITMAP_WORD_COUNT(TEST_OBJECT_COUNT)];
+    BitmapPool_t pool;
+    void * object_pointers[TEST_OBJECT_COUNT] = {};
+    void * token = NULL;
+    ErrorCode_t ret;
+
+    test_init_pool(&pool, buffer, bitmap);
+
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = bitmap_pool_allocate(&pool, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(&buffer[idx * TEST_OBJECT_SIZE_BYTES], object_pointers[idx]);
+        assert_int_equal(ERR_NONE, bitmap_pool_check(&pool, object_pointers[idx]));
+        assert_int_equal(TEST_OBJECT_COUNT - 1 - idx, bitmap_pool_get_available_count(&pool));
+    }
+
+    ret = bitmap_pool_allocate(&pool, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // a freed object in the first word is found again after the search moved on to the second word
+    ret = bitmap_pool_deallocate(&pool, &object_pointers[5]);
+    assert_int_equal(ERR_NONE, ret);
+    ret = bitmap_pool_allocate(&pool, &object_pointers[5]);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&buffer[5 * TEST_OBJECT_SIZE_BYTES], object_pointers[5]);
+
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = bitmap_pool_deallocate(&pool, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(NULL, object_pointers[idx]);
+        assert_int_equal(idx + 1, bitmap_pool_get_available_count(&pool));
+    }
+
+    bitmap_pool_deinit(&pool);
+
+    ret = bitmap_pool_allocate(&pool, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, bitmap_pool_get_available_count(&pool));
+}
+
+static void test_invalid_frees_are_detected(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT];
+    static uint32_t bitmap[BITMAP_POOL_BITMAP_WORD_COUNT(TEST_OBJECT_COUNT)];
+    BitmapPool_t pool;
+    void * object = NULL;
+    void * stale = NULL;
+    void * token = NULL;
+    ErrorCode_t ret;
+
+    test_init_pool(&pool, buffer, bitmap);
+
+    ret = bitmap_pool_allocate(&pool, &object);
+    assert_int_equal(ERR_NONE, ret);
+    stale = object;
+
+    // double free, the second is rejected and the pool is unchanged
+    ret = bitmap_pool_deallocate(&pool, &object);
+    assert_int_equal(ERR_NONE, ret);
+    ret = bitmap_pool_deallocate(&pool, &stale);
+    assert_int_equal(ERR_INVALID_STATE, ret);
+    assert_ptr_not_equal(NULL, stale);
+    assert_int_equal(ERR_INVALID_STATE, bitmap_pool_check(&pool, stale));
+    assert_int_equal(TEST_OBJECT_COUNT, bitmap_pool_get_available_count(&pool));
+
+    // never allocated objects are free too
+    token = &buffer[3 * TEST_OBJECT_SIZE_BYTES];
+    ret = bitmap_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_INVALID_STATE, ret);
+
+    // stray pointers
+    token = NULL;
+    ret = bitmap_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+    token = &buffer[TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT];
+    ret = bitmap_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+    token = &buffer[TEST_OBJECT_SIZE_BYTES + 1];
+    ret = bitmap_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, bitmap_pool_check(&pool, token));
+
+    assert_int_equal(TEST_OBJECT_COUNT, bitmap_pool_get_available_count(&pool));
+}
+
+int test_bitmap_pool_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_interface),
+        cmocka_unit_test(test_invalid_configs),
+        cmocka_unit_test(test_allocation_fills_and_unfills_correctly),
+        cmocka_unit_test(test_invalid_frees_are_detected),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
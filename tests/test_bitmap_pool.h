@@ -0,0 +1,3 @@
+#pragma once
+
+int test_bitmap_pool_run_tests(void);
@@ -0,0 +1,196 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/blocking_copy_queue.h>
+#include "test_blocking_copy_queue.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define ITEMS_IN_TEST_QUEUE (4)
+#define ITEMS_IN_THREAD_TEST (1u << 14)
+#define TEST_TIMEOUT_MS (20)
+
+static uint64_t test_get_time_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000u) + ((uint64_t)now.tv_nsec / 1000000u);
+}
+
+static void test_init_queue(BlockingCopyQueue_t * queue, uint32_t * queue_buffer)
+{
+    CopyQueueConfig_t config = {
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = sizeof(uint32_t),
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(uint32_t) * ITEMS_IN_TEST_QUEUE,
+    };
+
+    ErrorCode_t result = blocking_copy_queue_init(queue, &config);
+    assert_int_equal(ERR_NONE, result);
+}
+
+static void test_timeouts(void ** state)
+{
+    (void)state;
+
+    static uint32_t queue_buffer[ITEMS_IN_TEST_QUEUE];
+    BlockingCopyQueue_t queue;
+    ErrorCode_t result;
+    uint32_t element = 0;
+
+    test_init_queue(&queue, queue_buffer);
+
+    result = blocking_copy_queue_dequeue_timed(&queue, &element, 0);
+    assert_int_equal(ERR_TIMEOUT, result);
+
+    uint64_t start = test_get_time_ms();
+    result = blocking_copy_queue_dequeue_timed(&queue, &element, TEST_TIMEOUT_MS);
+    assert_int_equal(ERR_TIMEOUT, result);
+    assert_true((test_get_time_ms() - start) >= TEST_TIMEOUT_MS);
+
+    for (uint32_t idx = 0; idx < ITEMS_IN_TEST_QUEUE; ++idx)
+    {
+        result = blocking_copy_queue_enqueue_timed(&queue, &idx, 0);
+        assert_int_equal(ERR_NONE, result);
+    }
+
+    start = test_get_time_ms();
+    result = blocking_copy_queue_enqueue_timed(&queue, &element, TEST_TIMEOUT_MS);
+    assert_int_equal(ERR_TIMEOUT, result);
+    assert_true((test_get_time_ms() - start) >= TEST_TIMEOUT_MS);
+
+    for (uint32_t idx = 0; idx < ITEMS_IN_TEST_QUEUE; ++idx)
+    {
+        result = blocking_copy_queue_dequeue_timed(&queue, &element, BLOCKING_COPY_QUEUE_WAIT_FOREVER);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(idx, element);
+    }
+
+    // nothing was waiting, so nothing was woken
+    assert_int_equal(0, blocking_copy_queue_get_wake_count(&queue));
+    assert_int_equal(0, blocking_copy_queue_get_size(&queue));
+
+    blocking_copy_queue_deinit(&queue);
+}
+
+static void * test_single_dequeue_thread(void * arg)
+{
+    BlockingCopyQueue_t * queue = arg;
+    uint32_t element;
+
+    ErrorCode_t result = blocking_copy_queue_dequeue_timed(queue, &element, BLOCKING_COPY_QUEUE_WAIT_FOREVER);
+    return (void *)(uintptr_t)((result == ERR_NONE) && (element == 0));
+}
+
+static void test_burst_wakes_once(void ** state)
+{
+    (void)state;
+
+    static uint32_t queue_buffer[ITEMS_IN_TEST_QUEUE];
+    BlockingCopyQueue_t queue;
+    pthread_t consumer;
+    size_t waiting = 0;
+    void * consumer_result;
+
+    test_init_queue(&queue, queue_buffer);
+
+    assert_int_equal(0, pthread_create(&consumer, NULL, test_single_dequeue_thread, &queue));
+
+    while (waiting == 0)
+    {
+        sched_yield();
+        pthread_mutex_lock(&queue.lock);
+        waiting = queue.waiting_consumers;
+        pthread_mutex_unlock(&queue.lock);
+    }
+
+    for (uint32_t idx = 0; idx < ITEMS_IN_TEST_QUEUE; ++idx)
+    {
+        ErrorCode_t result = blocking_copy_queue_enqueue_timed(&queue, &idx, 0);
+        assert_int_equal(ERR_NONE, result);
+    }
+
+    assert_int_equal(0, pthread_join(consumer, &consumer_result));
+    assert_true((uintptr_t)consumer_result);
+
+    assert_int_equal(1, blocking_copy_queue_get_wake_count(&queue));
+    assert_int_equal(ITEMS_IN_TEST_QUEUE - 1, blocking_copy_queue_get_size(&queue));
+
+    blocking_copy_queue_deinit(&queue);
+}
+
+static void * test_producer_thread(void * arg)
+{
+    BlockingCopyQueue_t * queue = arg;
+
+    for (uint32_t idx = 0; idx < ITEMS_IN_THREAD_TEST; ++idx)
+    {
+        blocking_copy_queue_enqueue_timed(queue, &idx, BLOCKING_COPY_QUEUE_WAIT_FOREVER);
+    }
+    return NULL;
+}
+
+static void test_producer_consumer_threads(void ** state)
+{
+    (void)state;
+
+    static uint32_t queue_buffer[ITEMS_IN_TEST_QUEUE];
+    BlockingCopyQueue_t queue;
+    pthread_t producer;
+    size_t order_errors = 0;
+    uint32_t element;
+
+    test_init_queue(&queue, queue_buffer);
+
+    assert_int_equal(0, pthread_create(&producer, NULL, test_producer_thread, &queue));
+
+    for (uint32_t idx = 0; idx < ITEMS_IN_THREAD_TEST; ++idx)
+    {
+        ErrorCode_t result = blocking_copy_queue_dequeue_timed(&queue, &element, BLOCKING_COPY_QUEUE_WAIT_FOREVER);
+        assert_int_equal(ERR_NONE, result);
+        if (element != idx) order_errors++;
+    }
+
+    assert_int_equal(0, pthread_join(producer, NULL));
+    assert_int_equal(0, order_errors);
+    assert_int_equal(0, blocking_copy_queue_get_size(&queue));
+    assert_true(blocking_copy_queue_get_wake_count(&queue) <= (2 * ITEMS_IN_THREAD_TEST));
+
+    blocking_copy_queue_deinit(&queue);
+}
+
+static void test_bad_config(void ** state)
+{
+    (void)state;
+
+    static uint32_t queue_buffer[ITEMS_IN_TEST_QUEUE];
+    CopyQueueConfig_t config = {
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = 0,
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+    };
+    BlockingCopyQueue_t queue;
+
+    ErrorCode_t result = blocking_copy_queue_init(&queue, &config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+}
+
+int test_blocking_copy_queue_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_timeouts),
+        cmocka_unit_test(test_burst_wakes_once),
+        cmocka_unit_test(test_producer_consumer_threads),
+        cmocka_unit_test(test_bad_config),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -8,6 +8,7 @@
 #include <cemb/bounded_heap.h>
 
 #define HEAP_ITEM_COUNT (10)
+#define LARGE_HEAP_ITEM_COUNT (100)
 
 /**
  *  @brief  For a max heap (root is max), we need to trigger a swap if the parent if less than the child. 
@@ -35,6 +36,15 @@ static void test_bad_init(void ** state)
     ret = bounded_heap_init(&heap, &heap_cfg);
     assert_int_equal(ERR_INVALID_ARG, ret);
     heap_cfg.element_count = HEAP_ITEM_COUNT;
+
+    heap_cfg.arity = 1;
+    ret = bounded_heap_init(&heap, &heap_cfg);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    heap_cfg.arity = 3;
+    ret = bounded_heap_init(&heap, &heap_cfg);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+    heap_cfg.arity = 0;
 }
 
 /**
@@ -168,6 +178,185 @@ static void test_random_order_max_heap(void ** state)
     test_max_heap_test_scaffold(values, heap_storage, min_value, HEAP_ITEM_COUNT);
 }
 
+/**
+ * @brief Pushes and pops a mix of repeated and unordered values through heaps of each arity, with sizes that leave
+ *        nodes with only some of their children.
+ */
+static void test_arity_max_heap(void ** state)
+{
+    (void)state;
+
+    size_t const arities[] = {0, 2, 4, 8, 16};
+    void * heap_storage[LARGE_HEAP_ITEM_COUNT];
+    uint32_t value_state = 0x9e3779b9u;
+
+    for (size_t arity_idx = 0; arity_idx < sizeof(arities) / sizeof(arities[0]); ++arity_idx)
+    {
+        ErrorCode_t ret;
+        BoundedHeap_t heap;
+        BoundedHeapConfig_t heap_cfg = {
+            .heap_storage = heap_storage,
+            .element_count = LARGE_HEAP_ITEM_COUNT,
+            .compare = max_heap_compare,
+            .arity = arities[arity_idx],
+        };
+
+        ret = bounded_heap_init(&heap, &heap_cfg);
+        assert_int_equal(ERR_NONE, ret);
+
+        // pops part way through the pushes, so items are sifted through partly filled levels
+        size_t pushed_count = 0;
+        intptr_t previous_value = INTPTR_MAX;
+        for (size_t round = 0; round < 3; ++round)
+        {
+            for (size_t idx = 0; idx < (LARGE_HEAP_ITEM_COUNT / 3); ++idx)
+            {
+                value_state = (value_state * 1103515245u) + 12345u;
+                ret = bounded_heap_push(&heap, (void *)(intptr_t)((value_state >> 16) % 50));
+                assert_int_equal(ERR_NONE, ret);
+                pushed_count++;
+            }
+
+            void * pop_value;
+            ret = bounded_heap_pop(&heap, &pop_value);
+            assert_int_equal(ERR_NONE, ret);
+            pushed_count--;
+        }
+
+        for (size_t idx = 0; idx < pushed_count; ++idx)
+        {
+            void * pop_value;
+            ret = bounded_heap_pop(&heap, &pop_value);
+            assert_int_equal(ERR_NONE, ret);
+            assert_true((intptr_t)pop_value <= previous_value);
+            previous_value = (intptr_t)pop_value;
+        }
+        assert_int_equal(0, bounded_heap_get_size(&heap));
+
+        bounded_heap_deinit(&heap);
+    }
+}
+
+/**
+ * @brief Builds heaps of each arity from unordered values, on top of a few pushed items, then checks the pop order.
+ */
+static void test_build_max_heap(void ** state)
+{
+    (void)state;
+
+    size_t const arities[] = {2, 4, 8};
+    void * heap_storage[LARGE_HEAP_ITEM_COUNT];
+    void * values[LARGE_HEAP_ITEM_COUNT];
+    uint32_t value_state = 0x2545f491u;
+
+    for (size_t idx = 0; idx < LARGE_HEAP_ITEM_COUNT; ++idx)
+    {
+        value_state = (value_state * 1103515245u) + 12345u;
+        values[idx] = (void *)(intptr_t)((value_state >> 16) % 50);
+    }
+
+    for (size_t arity_idx = 0; arity_idx < sizeof(arities) / sizeof(arities[0]); ++arity_idx)
+    {
+        ErrorCode_t ret;
+        BoundedHeap_t heap;
+        BoundedHeapConfig_t heap_cfg = {
+            .heap_storage = heap_storage,
+            .element_count = LARGE_HEAP_ITEM_COUNT,
+            .compare = max_heap_compare,
+            .arity = arities[arity_idx],
+        };
+
+        ret = bounded_heap_init(&heap, &heap_cfg);
+        assert_int_equal(ERR_NONE, ret);
+
+        ret = bounded_heap_build(&heap, values, 0);
+        assert_int_equal(ERR_NONE, ret);
+        ret = bounded_heap_build(&heap, values, 1);
+        assert_int_equal(ERR_NONE, ret);
+        ret = bounded_heap_push(&heap, (void *)(intptr_t)7);
+        assert_int_equal(ERR_NONE, ret);
+
+        // too many for the space left, nothing is added
+        ret = bounded_heap_build(&heap, values, LARGE_HEAP_ITEM_COUNT - 1);
+        assert_int_equal(ERR_NO_MEM, ret);
+        assert_int_equal(2, bounded_heap_get_size(&heap));
+
+        ret = bounded_heap_build(&heap, &values[1], LARGE_HEAP_ITEM_COUNT - 2);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(0, bounded_heap_get_remaining(&heap));
+
+        intptr_t previous_value = INTPTR_MAX;
+        for (size_t idx = 0; idx < LARGE_HEAP_ITEM_COUNT; ++idx)
+        {
+            void * pop_value;
+            ret = bounded_heap_pop(&heap, &pop_value);
+            assert_int_equal(ERR_NONE, ret);
+            assert_true((intptr_t)pop_value <= previous_value);
+            previous_value = (intptr_t)pop_value;
+        }
+
+        bounded_heap_deinit(&heap);
+    }
+}
+
+static void test_pushpop_and_replace_top(void ** state)
+{
+    (void)state;
+
+    ErrorCode_t ret;
+    void * heap_storage[HEAP_ITEM_COUNT];
+    void * values[] = {(void *)10, (void *)20, (void *)30, (void *)40};
+    void * popped = NULL;
+    BoundedHeap_t heap;
+    BoundedHeapConfig_t heap_cfg = {
+        .heap_storage = heap_storage,
+        .element_count = HEAP_ITEM_COUNT,
+        .compare = max_heap_compare
+    };
+
+    ret = bounded_heap_init(&heap, &heap_cfg);
+    assert_int_equal(ERR_NONE, ret);
+
+    // on an empty heap, pushpop hands the item back and replace top has nothing to replace
+    ret = bounded_heap_pushpop(&heap, (void *)5, &popped);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal((void *)5, popped);
+    assert_int_equal(0, bounded_heap_get_size(&heap));
+
+    ret = bounded_heap_replace_top(&heap, (void *)5, &popped);
+    assert_int_equal(ERR_EMPTY, ret);
+    assert_int_equal(0, bounded_heap_get_size(&heap));
+
+    ret = bounded_heap_build(&heap, values, 4);
+    assert_int_equal(ERR_NONE, ret);
+
+    // an item above the root is popped straight back out
+    ret = bounded_heap_pushpop(&heap, (void *)50, &popped);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal((void *)50, popped);
+
+    ret = bounded_heap_pushpop(&heap, (void *)25, &popped);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal((void *)40, popped);
+
+    // replace top always gives the old root, even when the new item belongs above it
+    ret = bounded_heap_replace_top(&heap, (void *)60, &popped);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal((void *)30, popped);
+
+    ret = bounded_heap_replace_top(&heap, (void *)15, &popped);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal((void *)60, popped);
+    assert_int_equal(4, bounded_heap_get_size(&heap));
+
+    void * const expected[] = {(void *)25, (void *)20, (void *)15, (void *)10};
+    for (size_t idx = 0; idx < 4; ++idx)
+    {
+        ret = bounded_heap_pop(&heap, &popped);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(expected[idx], popped);
+    }
+}
 
 int test_bounded_heap_run_tests(void) {
     const struct CMUnitTest tests[] = {
@@ -176,6 +365,9 @@ int test_bounded_heap_run_tests(void) {
         cmocka_unit_test(test_ascending_max_heap),
         cmocka_unit_test(test_descending_max_heap),
         cmocka_unit_test(test_random_order_max_heap),
+        cmocka_unit_test(test_arity_max_heap),
+        cmocka_unit_test(test_build_max_heap),
+        cmocka_unit_test(test_pushpop_and_replace_top),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
\ No newline at end of file
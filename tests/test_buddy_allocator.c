@@ -0,0 +1,253 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/buddy_allocator.h>
+#include "test_buddy_allocator.h"
+
+#define TEST_BUFFER_SIZE (1024)
+#define TEST_MIN_BLOCK_SIZE (64)
+#define TEST_BITMAP_WORD_COUNT (BUDDY_ALLOCATOR_BITMAP_WORD_COUNT(TEST_BUFFER_SIZE, TEST_MIN_BLOCK_SIZE))
+
+static _Alignas(TEST_BUFFER_SIZE) uint8_t test_buffer[TEST_BUFFER_SIZE];
+static uint32_t test_bitmap[TEST_BITMAP_WORD_COUNT];
+
+static BuddyAllocatorConfig_t test_get_config(void)
+{
+    BuddyAllocatorConfig_t config = {
+        .buffer = test_buffer,
+        .buffer_size = sizeof(test_buffer),
+        .min_block_size = TEST_MIN_BLOCK_SIZE,
+        .bitmap = test_bitmap,
+        .bitmap_word_count = TEST_BITMAP_WORD_COUNT,
+    };
+    return config;
+}
+
+static void test_correct_interface(void ** state)
+{
+    (void)state;
+
+    BuddyAllocatorConfig_t config = test_get_config();
+    BuddyAllocator_t buddy;
+    IPoolAllocator_t interface;
+    void * object = NULL;
+
+    assert_int_equal(ERR_NONE, buddy_allocator_init(&buddy, &config));
+
+    ErrorCode_t ret = buddy_allocator_as_i_pool_allocator(&buddy, &interface);
+    assert_int_equal(ERR_NONE, ret);
+
+    assert_ptr_equal(interface.context, &buddy);
+    assert_ptr_equal(interface.deallocate, buddy_allocator_deallocate);
+    assert_ptr_equal(interface.get_available_count, buddy_allocator_get_free_bytes);
+    assert_ptr_equal(interface.allocate_sized, buddy_allocator_allocate);
+
+    // unsized requests are served with the smallest block
+    ret = i_pool_allocator_allocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - TEST_MIN_BLOCK_SIZE, i_pool_allocator_get_available_count(&interface));
+    ret = i_pool_allocator_deallocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE, i_pool_allocator_get_available_count(&interface));
+
+    ret = i_pool_allocator_allocate_sized(&interface, 100, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE - 128, i_pool_allocator_get_available_count(&interface));
+    ret = i_pool_allocator_deallocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(NULL, object);
+
+    buddy_allocator_deinit(&buddy);
+}
+
+static void test_invalid_configs(void ** state)
+{
+    (void)state;
+
+    BuddyAllocatorConfig_t config = test_get_config();
+    BuddyAllocatorConfig_t test_config;
+    BuddyAllocator_t buddy;
+    ErrorCode_t ret;
+
+    test_config = config;
+    test_config.buffer_size = TEST_BUFFER_SIZE - TEST_MIN_BLOCK_SIZE;
+    ret = buddy_allocator_init(&buddy, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.min_block_size = 48;
+    ret = buddy_allocator_init(&buddy, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.min_block_size = sizeof(BuddyFreeBlock_t) / 2;
+    ret = buddy_allocator_init(&buddy, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.min_block_size = TEST_BUFFER_SIZE * 2;
+    ret = buddy_allocator_init(&buddy, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.bitmap_word_count = TEST_BITMAP_WORD_COUNT - 1;
+    ret = buddy_allocator_init(&buddy, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+}
+
+static void test_split_and_merge(void ** state)
+{
+    (void)state;
+
+    BuddyAllocatorConfig_t config = test_get_config();
+    BuddyAllocator_t buddy;
+    void * objects[TEST_BUFFER_SIZE / TEST_MIN_BLOCK_SIZE] = {};
+    void * object = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, buddy_allocator_init(&buddy, &config));
+
+    ret = buddy_allocator_allocate(&buddy, 0, &object);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+    ret = buddy_allocator_allocate(&buddy, TEST_BUFFER_SIZE + 1, &object);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    // small requests are rounded to the minimum block, and the blocks follow each other
+    for (size_t idx = 0; idx < TEST_BUFFER_SIZE / TEST_MIN_BLOCK_SIZE; ++idx)
+    {
+        ret = buddy_allocator_allocate(&buddy, 1, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(&test_buffer[idx * TEST_MIN_BLOCK_SIZE], objects[idx]);
+    }
+    assert_int_equal(0, buddy_allocator_get_free_bytes(&buddy));
+
+    ret = buddy_allocator_allocate(&buddy, 1, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // blocks 1 and 2 are free but not buddies, so they cannot merge into a 128 byte block
+    ret = buddy_allocator_deallocate(&buddy, &objects[1]);
+    assert_int_equal(ERR_NONE, ret);
+    ret = buddy_allocator_deallocate(&buddy, &objects[2]);
+    assert_int_equal(ERR_NONE, ret);
+    ret = buddy_allocator_allocate(&buddy, 128, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // freeing block 3 merges it with block 2
+    ret = buddy_allocator_deallocate(&buddy, &objects[3]);
+    assert_int_equal(ERR_NONE, ret);
+    ret = buddy_allocator_allocate(&buddy, 128, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&test_buffer[2 * TEST_MIN_BLOCK_SIZE], object);
+    objects[2] = object;
+    objects[3] = NULL;
+
+    // freeing everything merges all the way back to the whole buffer
+    for (size_t idx = 0; idx < TEST_BUFFER_SIZE / TEST_MIN_BLOCK_SIZE; ++idx)
+    {
+        if (objects[idx] == NULL) continue;
+        ret = buddy_allocator_deallocate(&buddy, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+    assert_int_equal(TEST_BUFFER_SIZE, buddy_allocator_get_free_bytes(&buddy));
+
+    ret = buddy_allocator_allocate(&buddy, TEST_BUFFER_SIZE, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(test_buffer, object);
+    assert_int_equal(0, buddy_allocator_get_free_bytes(&buddy));
+
+    buddy_allocator_deinit(&buddy);
+}
+
+static void test_mixed_sizes(void ** state)
+{
+    (void)state;
+
+    BuddyAllocatorConfig_t config = test_get_config();
+    BuddyAllocator_t buddy;
+    void * small = NULL;
+    void * medium = NULL;
+    void * large = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, buddy_allocator_init(&buddy, &config));
+
+    // 64 + 256 + 512, each aligned to its own size
+    ret = buddy_allocator_allocate(&buddy, 33, &small);
+    assert_int_equal(ERR_NONE, ret);
+    ret = buddy_allocator_allocate(&buddy, 200, &medium);
+    assert_int_equal(ERR_NONE, ret);
+    ret = buddy_allocator_allocate(&buddy, 512, &large);
+    assert_int_equal(ERR_NONE, ret);
+
+    assert_int_equal(0, ((uint8_t *)small - test_buffer) % 64);
+    assert_int_equal(0, ((uint8_t *)medium - test_buffer) % 256);
+    assert_int_equal(0, ((uint8_t *)large - test_buffer) % 512);
+    assert_int_equal(TEST_BUFFER_SIZE - 64 - 256 - 512, buddy_allocator_get_free_bytes(&buddy));
+
+    // the 64 and 128 byte blocks split off for the small block remain
+    ret = buddy_allocator_allocate(&buddy, 256, &large);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    ret = buddy_allocator_deallocate(&buddy, &small);
+    assert_int_equal(ERR_NONE, ret);
+    ret = buddy_allocator_allocate(&buddy, 256, &small);
+    assert_int_equal(ERR_NONE, ret);
+
+    buddy_allocator_deinit(&buddy);
+}
+
+static void test_invalid_deallocations(void ** state)
+{
+    (void)state;
+
+    BuddyAllocatorConfig_t config = test_get_config();
+    BuddyAllocator_t buddy;
+    void * object = NULL;
+    void * copy = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, buddy_allocator_init(&buddy, &config));
+
+    ret = buddy_allocator_deallocate(&buddy, &object);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    object = &test_buffer[TEST_BUFFER_SIZE];
+    ret = buddy_allocator_deallocate(&buddy, &object);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    ret = buddy_allocator_allocate(&buddy, 128, &object);
+    assert_int_equal(ERR_NONE, ret);
+
+    // a pointer inside the block is not the block
+    copy = (uint8_t *)object + TEST_MIN_BLOCK_SIZE;
+    ret = buddy_allocator_deallocate(&buddy, &copy);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    copy = object;
+    ret = buddy_allocator_deallocate(&buddy, &object);
+    assert_int_equal(ERR_NONE, ret);
+    ret = buddy_allocator_deallocate(&buddy, &copy);
+    assert_int_equal(ERR_INVALID_STATE, ret);
+    assert_int_equal(TEST_BUFFER_SIZE, buddy_allocator_get_free_bytes(&buddy));
+
+    buddy_allocator_deinit(&buddy);
+
+    ret = buddy_allocator_allocate(&buddy, 128, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, buddy_allocator_get_free_bytes(&buddy));
+}
+
+int test_buddy_allocator_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_interface),
+        cmocka_unit_test(test_invalid_configs),
+        cmocka_unit_test(test_split_and_merge),
+        cmocka_unit_test(test_mixed_sizes),
+        cmocka_unit_test(test_invalid_deallocations),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -108,6 +108,110 @@ static void test_correct_ordering_with_overflow(void ** state)
     assert_int_equal(ERR_EMPTY, result);
 }
 
+static void test_block_push_pop_wraps(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    CircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    CircularBuffer_t circular;
+    ErrorCode_t result;
+    uint8_t input[ITEMS_IN_TEST_BUFFER];
+    uint8_t output[ITEMS_IN_TEST_BUFFER * 2];
+    size_t count;
+
+    for (uint8_t idx = 0; idx < ITEMS_IN_TEST_BUFFER; ++idx)
+    {
+        input[idx] = idx;
+    }
+
+    result = circular_buffer_init(&circular, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    // move the indexes near the end so the next block needs to wrap
+    result = circular_buffer_push(&circular, input, 10);
+    assert_int_equal(ERR_NONE, result);
+    count = circular_buffer_pop(&circular, output, 8);
+    assert_int_equal(8, count);
+    assert_memory_equal(input, output, 8);
+
+    result = circular_buffer_push(&circular, input, 10);
+    assert_int_equal(ERR_NONE, result);
+    assert_int_equal(12, circular_buffer_get_count(&circular));
+
+    // peeking does not consume
+    count = circular_buffer_peek(&circular, output, sizeof(output));
+    assert_int_equal(12, count);
+    assert_int_equal(12, circular_buffer_get_count(&circular));
+
+    // asking for more than is available only returns what is there
+    count = circular_buffer_pop(&circular, output, sizeof(output));
+    assert_int_equal(12, count);
+    assert_memory_equal(&input[8], &output[0], 2);
+    assert_memory_equal(input, &output[2], 10);
+
+    count = circular_buffer_pop(&circular, output, sizeof(output));
+    assert_int_equal(0, count);
+
+    // single byte access still agrees with the block access
+    result = circular_buffer_push(&circular, input, 3);
+    assert_int_equal(ERR_NONE, result);
+    uint8_t byte_out;
+    result = circular_buffer_pop_byte(&circular, &byte_out);
+    assert_int_equal(ERR_NONE, result);
+    assert_int_equal(0, byte_out);
+    assert_int_equal(2, circular_buffer_get_count(&circular));
+}
+
+static void test_block_push_overrides_oldest(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    CircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    CircularBuffer_t circular;
+    ErrorCode_t result;
+    uint8_t input[ITEMS_IN_TEST_BUFFER * 2];
+    uint8_t output[ITEMS_IN_TEST_BUFFER];
+    size_t count;
+
+    for (uint8_t idx = 0; idx < sizeof(input); ++idx)
+    {
+        input[idx] = idx;
+    }
+
+    result = circular_buffer_init(&circular, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    // 10 + 10 bytes into a 15 byte buffer, the first 5 are lost
+    result = circular_buffer_push(&circular, input, 10);
+    assert_int_equal(ERR_NONE, result);
+    result = circular_buffer_push(&circular, &input[10], 10);
+    assert_int_equal(ERR_NONE, result);
+    assert_int_equal(ITEMS_IN_TEST_BUFFER, circular_buffer_get_count(&circular));
+
+    count = circular_buffer_pop(&circular, output, sizeof(output));
+    assert_int_equal(ITEMS_IN_TEST_BUFFER, count);
+    assert_memory_equal(&input[5], output, ITEMS_IN_TEST_BUFFER);
+
+    // a block larger than the buffer keeps only the newest bytes
+    result = circular_buffer_push(&circular, input, 4);
+    assert_int_equal(ERR_NONE, result);
+    result = circular_buffer_push(&circular, input, sizeof(input));
+    assert_int_equal(ERR_NONE, result);
+    assert_int_equal(ITEMS_IN_TEST_BUFFER, circular_buffer_get_count(&circular));
+
+    count = circular_buffer_pop(&circular, output, sizeof(output));
+    assert_int_equal(ITEMS_IN_TEST_BUFFER, count);
+    assert_memory_equal(&input[sizeof(input) - ITEMS_IN_TEST_BUFFER], output, ITEMS_IN_TEST_BUFFER);
+}
+
 static void test_bad_config(void ** state)
 {
     (void)state;
@@ -147,6 +251,14 @@ static void test_deinit_prevents_actions(void ** state)
     result = circular_buffer_pop_byte(&circular, &dummy);
     assert_int_equal(ERR_EMPTY, result);
 
+    result = circular_buffer_push(&circular, &dummy, 1);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    items_in_buffer = circular_buffer_pop(&circular, &dummy, 1);
+    assert_int_equal(0, items_in_buffer);
+
+    items_in_buffer = circular_buffer_peek(&circular, &dummy, 1);
+    assert_int_equal(0, items_in_buffer);
 }
 
 int test_circular_buffer_run_tests(void)
@@ -154,6 +266,8 @@ int test_circular_buffer_run_tests(void)
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_ripple_insert),
         cmocka_unit_test(test_correct_ordering_with_overflow),
+        cmocka_unit_test(test_block_push_pop_wraps),
+        cmocka_unit_test(test_block_push_overrides_oldest),
         cmocka_unit_test(test_bad_config),
         cmocka_unit_test(test_deinit_prevents_actions),
     };
@@ -0,0 +1,242 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/concurrent_pool.h>
+#include "test_concurrent_pool.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+
+#define TEST_OBJECT_COUNT (16)
+#define TEST_OBJECT_SIZE_BYTES (sizeof(uint64_t))
+#define TEST_THREAD_COUNT (4)
+#define TEST_ALLOCATIONS_PER_THREAD (1u << 14)
+#define TEST_OBJECTS_HELD_PER_THREAD (3)
+
+static void test_init_pool(ConcurrentPool_t * pool, uint64_t * buffer, atomic_size_t * link_buffer)
+{
+    ConcurrentPoolConfig_t config = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT,
+        .object_size = TEST_OBJECT_SIZE_BYTES,
+        .object_count = TEST_OBJECT_COUNT,
+        .link_buffer = link_buffer,
+    };
+
+    ErrorCode_t ret = concurrent_pool_init(pool, &config);
+    assert_int_equal(ERR_NONE, ret);
+}
+
+static void test_correct_interface(void ** state)
+{
+    (void)state;
+
+    static uint64_t buffer[TEST_OBJECT_COUNT];
+    static atomic_size_t link_buffer[TEST_OBJECT_COUNT];
+    ConcurrentPool_t pool;
+    IPoolAllocator_t interface;
+    void * object = NULL;
+
+    test_init_pool(&pool, buffer, link_buffer);
+
+    ErrorCode_t ret = concurrent_pool_as_i_pool_allocator(&pool, &interface);
+    assert_int_equal(ERR_NONE, ret);
+
+    assert_ptr_equal(interface.context, &pool);
+    assert_ptr_equal(interface.allocate, concurrent_pool_allocate);
+    assert_ptr_equal(interface.deallocate, concurrent_pool_deallocate);
+    assert_ptr_equal(interface.get_available_count, concurrent_pool_get_available_count);
+    assert_ptr_equal(NULL, interface.allocate_sized);
+
+    ret = i_pool_allocator_allocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_OBJECT_COUNT - 1, i_pool_allocator_get_available_count(&interface));
+    ret = i_pool_allocator_deallocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(NULL, object);
+
+    concurrent_pool_deinit(&pool);
+}
+
+static void test_invalid_configs(void ** state)
+{
+    (void)state;
+
+    static uint64_t buffer[TEST_OBJECT_COUNT];
+    static atomic_size_t link_buffer[TEST_OBJECT_COUNT];
+    ConcurrentPoolConfig_t config = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = TEST_OBJECT_SIZE_BYTES,
+        .object_count = TEST_OBJECT_COUNT,
+        .link_buffer = link_buffer,
+    };
+    ConcurrentPoolConfig_t test_config;
+    ConcurrentPool_t pool;
+    ErrorCode_t ret;
+
+    test_config = config;
+    test_config.buffer_size = sizeof(buffer) - 1;
+    ret = concurrent_pool_init(&pool, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.object_size = 0;
+    ret = concurrent_pool_init(&pool, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.object_count = 0;
+    ret = concurrent_pool_init(&pool, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+}
+
+static void test_allocation_fills_and_unfills_correctly(void ** state)
+{
+    (void)state;
+
+    static uint64_t buffer[TEST_OBJECT_COUNT];
+    static atomic_size_t link_buffer[TEST_OBJECT_COUNT];
+    ConcurrentPool_t pool;
+    void * object_pointers[TEST_OBJECT_COUNT] = {};
+    void * token = NULL;
+    ErrorCode_t ret;
+
+    test_init_pool(&pool, buffer, link_buffer);
+
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = concurrent_pool_allocate(&pool, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(&buffer[idx], object_pointers[idx]);
+        assert_int_equal(TEST_OBJECT_COUNT - 1 - idx, concurrent_pool_get_available_count(&pool));
+    }
+
+    ret = concurrent_pool_allocate(&pool, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // pointers that are NULL, outside the buffer or not at the start of an object are rejected
+    token = NULL;
+    ret = concurrent_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+    token = &buffer[TEST_OBJECT_COUNT];
+    ret = concurrent_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+    token = (uint8_t *)&buffer[1] + 1;
+    ret = concurrent_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = concurrent_pool_deallocate(&pool, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(NULL, object_pointers[idx]);
+        assert_int_equal(idx + 1, concurrent_pool_get_available_count(&pool));
+    }
+
+    // the most recently freed object is reused first
+    ret = concurrent_pool_allocate(&pool, &token);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&buffer[TEST_OBJECT_COUNT - 1], token);
+
+    concurrent_pool_deinit(&pool);
+
+    ret = concurrent_pool_allocate(&pool, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, concurrent_pool_get_available_count(&pool));
+}
+
+typedef struct TestConcurrentPoolThreadArgs TestConcurrentPoolThreadArgs_t;
+
+struct TestConcurrentPoolThreadArgs
+{
+    ConcurrentPool_t * pool;
+    uint64_t thread_id;
+    size_t ownership_errors;
+};
+
+/**
+ * @brief Holds a few objects at a time, stamping each with the owning thread and checking the stamp is untouched
+ * before freeing. Two threads owning the same object would overwrite each other's stamp.
+ */
+static void * test_allocate_thread(void * context)
+{
+    TestConcurrentPoolThreadArgs_t * args = context;
+    void * held[TEST_OBJECTS_HELD_PER_THREAD];
+
+    for (uint64_t iteration = 0; iteration < TEST_ALLOCATIONS_PER_THREAD; ++iteration)
+    {
+        uint64_t stamp = (args->thread_id << 32) | iteration;
+
+        for (size_t idx = 0; idx < TEST_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            while (concurrent_pool_allocate(args->pool, &held[idx]) != ERR_NONE)
+            {
+                sched_yield();
+            }
+            *(uint64_t *)held[idx] = stamp;
+        }
+        for (size_t idx = 0; idx < TEST_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            if (*(uint64_t *)held[idx] != stamp) args->ownership_errors++;
+            concurrent_pool_deallocate(args->pool, &held[idx]);
+        }
+    }
+    return NULL;
+}
+
+static void test_threaded_ownership(void ** state)
+{
+    (void)state;
+
+    static uint64_t buffer[TEST_OBJECT_COUNT];
+    static atomic_size_t link_buffer[TEST_OBJECT_COUNT];
+    ConcurrentPool_t pool;
+    pthread_t threads[TEST_THREAD_COUNT];
+    TestConcurrentPoolThreadArgs_t args[TEST_THREAD_COUNT];
+
+    test_init_pool(&pool, buffer, link_buffer);
+
+    for (size_t idx = 0; idx < TEST_THREAD_COUNT; ++idx)
+    {
+        args[idx] = (TestConcurrentPoolThreadArgs_t){&pool, idx, 0};
+        assert_int_equal(0, pthread_create(&threads[idx], NULL, test_allocate_thread, &args[idx]));
+    }
+
+    for (size_t idx = 0; idx < TEST_THREAD_COUNT; ++idx)
+    {
+        assert_int_equal(0, pthread_join(threads[idx], NULL));
+        assert_int_equal(0, args[idx].ownership_errors);
+    }
+
+    // every object made it back, and each one exactly once
+    assert_int_equal(TEST_OBJECT_COUNT, concurrent_pool_get_available_count(&pool));
+
+    void * object_pointers[TEST_OBJECT_COUNT];
+    bool seen[TEST_OBJECT_COUNT] = {};
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        assert_int_equal(ERR_NONE, concurrent_pool_allocate(&pool, &object_pointers[idx]));
+        size_t index = (size_t)((uint64_t *)object_pointers[idx] - buffer);
+        assert_false(seen[index]);
+        seen[index] = true;
+    }
+    assert_int_equal(ERR_NO_MEM, concurrent_pool_allocate(&pool, &object_pointers[0]));
+
+    concurrent_pool_deinit(&pool);
+}
+
+int test_concurrent_pool_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_interface),
+        cmocka_unit_test(test_invalid_configs),
+        cmocka_unit_test(test_allocation_fills_and_unfills_correctly),
+        cmocka_unit_test(test_threaded_ownership),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -77,6 +77,187 @@ static void test_correct_fifo_ordering(void ** state)
 
 }
 
+/**
+ * The queue must wrap, so it keeps working long after element_count items have passed through it.
+ */
+static void test_wraps_around(void ** state)
+{
+    (void)state;
+
+    static int queue_buffer[ITEMS_IN_TEST_QUEUE];
+
+    CopyQueueConfig_t config = {
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = sizeof(int),
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+    };
+
+    CopyQueue_t queue;
+    ErrorCode_t result;
+    int next_in = 0;
+    int next_out = 0;
+    int output;
+
+    result = copy_queue_init(&queue, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    // 4 in and 3 out each cycle drifts the indexes around the ring several times, until the queue fills
+    while (copy_queue_get_remaining(&queue) >= 4)
+    {
+        for (int idx = 0; idx < 4; ++idx)
+        {
+            result = copy_queue_enqueue(&queue, &next_in);
+            assert_int_equal(ERR_NONE, result);
+            next_in++;
+        }
+        for (int idx = 0; idx < 3; ++idx)
+        {
+            result = copy_queue_dequeue(&queue, &output);
+            assert_int_equal(ERR_NONE, result);
+            assert_int_equal(next_out, output);
+            next_out++;
+        }
+    }
+
+    assert_true(next_in > (ITEMS_IN_TEST_QUEUE * 2));
+
+    while (copy_queue_get_size(&queue) > 0)
+    {
+        result = copy_queue_dequeue(&queue, &output);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(next_out, output);
+        next_out++;
+    }
+    assert_int_equal(next_in, next_out);
+}
+
+static void test_batched_enqueue_dequeue(void ** state)
+{
+    (void)state;
+
+    static int queue_buffer[ITEMS_IN_TEST_QUEUE];
+
+    CopyQueueConfig_t config = {
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = sizeof(int),
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+    };
+
+    CopyQueue_t queue;
+    ErrorCode_t result;
+    int input[ITEMS_IN_TEST_QUEUE * 2];
+    int output[ITEMS_IN_TEST_QUEUE * 2];
+    size_t count;
+
+    for (int idx = 0; idx < (ITEMS_IN_TEST_QUEUE * 2); ++idx)
+    {
+        input[idx] = idx;
+    }
+
+    result = copy_queue_init(&queue, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    count = copy_queue_enqueue_n(&queue, input, 10);
+    assert_int_equal(10, count);
+    count = copy_queue_dequeue_n(&queue, output, 8);
+    assert_int_equal(8, count);
+    assert_memory_equal(input, output, 8 * sizeof(int));
+
+    // only 13 free, the batch wraps around the end of the buffer and the rest is rejected
+    count = copy_queue_enqueue_n(&queue, &input[10], 20);
+    assert_int_equal(13, count);
+    assert_int_equal(ITEMS_IN_TEST_QUEUE, copy_queue_get_size(&queue));
+
+    // single element access agrees with the batched access
+    int single;
+    result = copy_queue_dequeue(&queue, &single);
+    assert_int_equal(ERR_NONE, result);
+    assert_int_equal(8, single);
+
+    count = copy_queue_dequeue_n(&queue, output, ITEMS_IN_TEST_QUEUE * 2);
+    assert_int_equal(ITEMS_IN_TEST_QUEUE - 1, count);
+    assert_memory_equal(&input[9], output, (ITEMS_IN_TEST_QUEUE - 1) * sizeof(int));
+
+    count = copy_queue_dequeue_n(&queue, output, 1);
+    assert_int_equal(0, count);
+}
+
+static void test_in_place_access(void ** state)
+{
+    (void)state;
+
+    static int queue_buffer[ITEMS_IN_TEST_QUEUE];
+
+    CopyQueueConfig_t config = {
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = sizeof(int),
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+    };
+
+    CopyQueue_t queue;
+    ErrorCode_t result;
+    void * slot;
+    void * other_slot;
+    int output;
+
+    result = copy_queue_init(&queue, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    result = copy_queue_front(&queue, &slot);
+    assert_int_equal(ERR_EMPTY, result);
+    result = copy_queue_release(&queue);
+    assert_int_equal(ERR_EMPTY, result);
+
+    // reserving twice without a commit hands out the same slot, and nothing is queued yet
+    result = copy_queue_reserve(&queue, &slot);
+    assert_int_equal(ERR_NONE, result);
+    result = copy_queue_reserve(&queue, &other_slot);
+    assert_int_equal(ERR_NONE, result);
+    assert_ptr_equal(slot, other_slot);
+    assert_int_equal(0, copy_queue_get_size(&queue));
+
+    // in place writes and reads interleave with the copying API, across several wraps
+    for (int idx = 0; idx < (ITEMS_IN_TEST_QUEUE * 3); ++idx)
+    {
+        result = copy_queue_reserve(&queue, &slot);
+        assert_int_equal(ERR_NONE, result);
+        *(int *)slot = idx;
+        result = copy_queue_commit(&queue);
+        assert_int_equal(ERR_NONE, result);
+
+        int next = idx + 1000;
+        result = copy_queue_enqueue(&queue, &next);
+        assert_int_equal(ERR_NONE, result);
+
+        result = copy_queue_front(&queue, &slot);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(idx, *(int *)slot);
+        result = copy_queue_release(&queue);
+        assert_int_equal(ERR_NONE, result);
+
+        result = copy_queue_dequeue(&queue, &output);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(idx + 1000, output);
+    }
+
+    // commit fails when there is no free slot
+    while (copy_queue_get_remaining(&queue) > 0)
+    {
+        result = copy_queue_reserve(&queue, &slot);
+        assert_int_equal(ERR_NONE, result);
+        result = copy_queue_commit(&queue);
+        assert_int_equal(ERR_NONE, result);
+    }
+    result = copy_queue_reserve(&queue, &slot);
+    assert_int_equal(ERR_NO_MEM, result);
+    result = copy_queue_commit(&queue);
+    assert_int_equal(ERR_NO_MEM, result);
+    assert_int_equal(ITEMS_IN_TEST_QUEUE, copy_queue_get_size(&queue));
+}
+
 static void test_bad_config(void ** state)
 {
     (void)state;
@@ -148,12 +329,34 @@ static void test_deinit_prevents_actions(void ** state)
 
     count = copy_queue_get_size(&queue);
     assert_int_equal(0, count);
+
+    count = copy_queue_enqueue_n(&queue, &dummy, 1);
+    assert_int_equal(0, count);
+
+    count = copy_queue_dequeue_n(&queue, &dummy, 1);
+    assert_int_equal(0, count);
+
+    void * slot;
+    result = copy_queue_reserve(&queue, &slot);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    result = copy_queue_commit(&queue);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    result = copy_queue_front(&queue, &slot);
+    assert_int_equal(ERR_EMPTY, result);
+
+    result = copy_queue_release(&queue);
+    assert_int_equal(ERR_EMPTY, result);
 }
 
 int test_copy_queue_run_tests(void)
 {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_correct_fifo_ordering),
+        cmocka_unit_test(test_wraps_around),
+        cmocka_unit_test(test_batched_enqueue_dequeue),
+        cmocka_unit_test(test_in_place_access),
         cmocka_unit_test(test_bad_config),
         cmocka_unit_test(test_deinit_prevents_actions),
     };
@@ -112,6 +112,132 @@ static void test_correct_ordering_with_overflow(void ** state)
     
 }
 
+/**
+ * Regions must never cross the end of the buffer, so a region near the end is split into two reservations.
+ */
+static void test_regions_are_contiguous(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    FastCircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    FastCircularBuffer_t circular;
+    ErrorCode_t result;
+    uint8_t * write_region = NULL;
+    uint8_t const * read_region = NULL;
+    size_t region_length = 0;
+
+    result = fast_circular_buffer_init(&circular, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    result = fast_circular_buffer_acquire_read(&circular, &read_region, &region_length);
+    assert_int_equal(ERR_EMPTY, result);
+
+    // an empty buffer hands out the whole buffer
+    result = fast_circular_buffer_reserve_write(&circular, &write_region, &region_length);
+    assert_int_equal(ERR_NONE, result);
+    assert_ptr_equal(&buffer[0], write_region);
+    assert_int_equal(ITEMS_IN_TEST_BUFFER, region_length);
+
+    for (uint8_t idx = 0; idx < 12; ++idx)
+    {
+        write_region[idx] = idx;
+    }
+    result = fast_circular_buffer_commit_write(&circular, 12);
+    assert_int_equal(ERR_NONE, result);
+    assert_int_equal(12, fast_circular_buffer_get_count(&circular));
+
+    result = fast_circular_buffer_acquire_read(&circular, &read_region, &region_length);
+    assert_int_equal(ERR_NONE, result);
+    assert_ptr_equal(&buffer[0], read_region);
+    assert_int_equal(12, region_length);
+
+    result = fast_circular_buffer_release_read(&circular, 10);
+    assert_int_equal(ERR_NONE, result);
+
+    // 2 bytes are left unread at [10, 11], so writing is limited to the end of the buffer first
+    result = fast_circular_buffer_reserve_write(&circular, &write_region, &region_length);
+    assert_int_equal(ERR_NONE, result);
+    assert_ptr_equal(&buffer[12], write_region);
+    assert_int_equal(4, region_length);
+    write_region[0] = 12;
+    write_region[1] = 13;
+    write_region[2] = 14;
+    write_region[3] = 15;
+    result = fast_circular_buffer_commit_write(&circular, 4);
+    assert_int_equal(ERR_NONE, result);
+
+    // then the wrapped region, which stops at the unread bytes
+    result = fast_circular_buffer_reserve_write(&circular, &write_region, &region_length);
+    assert_int_equal(ERR_NONE, result);
+    assert_ptr_equal(&buffer[0], write_region);
+    assert_int_equal(10, region_length);
+    write_region[0] = 16;
+    result = fast_circular_buffer_commit_write(&circular, 11);
+    assert_int_equal(ERR_INVALID_ARG, result);
+    result = fast_circular_buffer_commit_write(&circular, 1);
+    assert_int_equal(ERR_NONE, result);
+
+    // the reader sees the tail region first, then the wrapped region
+    result = fast_circular_buffer_acquire_read(&circular, &read_region, &region_length);
+    assert_int_equal(ERR_NONE, result);
+    assert_ptr_equal(&buffer[10], read_region);
+    assert_int_equal(6, region_length);
+    assert_int_equal(10, read_region[0]);
+    assert_int_equal(15, read_region[5]);
+    result = fast_circular_buffer_release_read(&circular, region_length);
+    assert_int_equal(ERR_NONE, result);
+
+    result = fast_circular_buffer_acquire_read(&circular, &read_region, &region_length);
+    assert_int_equal(ERR_NONE, result);
+    assert_ptr_equal(&buffer[0], read_region);
+    assert_int_equal(1, region_length);
+    assert_int_equal(16, read_region[0]);
+
+    result = fast_circular_buffer_release_read(&circular, 2);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    // regions and the byte API share the same indexes
+    uint8_t byte_out;
+    result = fast_circular_buffer_pop_byte(&circular, &byte_out);
+    assert_int_equal(ERR_NONE, result);
+    assert_int_equal(16, byte_out);
+    assert_int_equal(0, fast_circular_buffer_get_count(&circular));
+}
+
+static void test_reserve_write_when_full(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    FastCircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    FastCircularBuffer_t circular;
+    ErrorCode_t result;
+    uint8_t * write_region = NULL;
+    size_t region_length = 0;
+
+    result = fast_circular_buffer_init(&circular, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    for (uint8_t idx = 0; idx < ITEMS_IN_TEST_BUFFER; ++idx)
+    {
+        result = fast_circular_buffer_push_byte(&circular, idx);
+        assert_int_equal(ERR_NONE, result);
+    }
+
+    result = fast_circular_buffer_reserve_write(&circular, &write_region, &region_length);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    result = fast_circular_buffer_commit_write(&circular, 1);
+    assert_int_equal(ERR_INVALID_ARG, result);
+}
+
 static void test_bad_config(void ** state)
 {
     (void)state;
@@ -161,6 +287,21 @@ static void test_deinit_prevents_actions(void ** state)
     result = fast_circular_buffer_pop_byte(&circular, &dummy);
     assert_int_equal(ERR_EMPTY, result);
 
+    uint8_t * write_region = NULL;
+    uint8_t const * read_region = NULL;
+    size_t region_length = 0;
+
+    result = fast_circular_buffer_reserve_write(&circular, &write_region, &region_length);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    result = fast_circular_buffer_commit_write(&circular, 1);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    result = fast_circular_buffer_acquire_read(&circular, &read_region, &region_length);
+    assert_int_equal(ERR_EMPTY, result);
+
+    result = fast_circular_buffer_release_read(&circular, 1);
+    assert_int_equal(ERR_INVALID_ARG, result);
 }
 
 int test_fast_circular_buffer_run_tests(void)
@@ -168,6 +309,8 @@ int test_fast_circular_buffer_run_tests(void)
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_ripple_insert),
         cmocka_unit_test(test_correct_ordering_with_overflow),
+        cmocka_unit_test(test_regions_are_contiguous),
+        cmocka_unit_test(test_reserve_write_when_full),
         cmocka_unit_test(test_bad_config),
         cmocka_unit_test(test_deinit_prevents_actions),
     };
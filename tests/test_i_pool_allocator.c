@@ -62,12 +62,89 @@ static void test_get_unused_count(void ** state)
     assert_int_equal(5, unused_count);
 }
 
+static void test_allocate_sized_not_implemented(void ** state)
+{
+    (void)state;
+
+    void * object_pointer = NULL;
+    ErrorCode_t ret;
+    IPoolAllocator_t interface;
+    void * context = (void *)0xDEADBEEF;
+
+    mock_pool_allocator_get_interface(&interface, context);
+
+    ret = i_pool_allocator_allocate_sized(&interface, 4, &object_pointer);
+    assert_int_equal(ERR_NOT_IMPLEMENTED, ret);
+    assert_ptr_equal(NULL, object_pointer);
+}
+
+static void test_bulk_fallback(void ** state)
+{
+    (void)state;
+
+    void * object_pointers[3] = {};
+    ErrorCode_t ret;
+    IPoolAllocator_t interface;
+    void * context = (void *)0xDEADBEEF;
+
+    mock_pool_allocator_get_interface(&interface, context);
+
+    // without bulk functions, each object is handled by the single object functions
+    for (size_t idx = 0; idx < 3; ++idx)
+    {
+        mock_pool_allocator_setup_allocate_with_count(context, &object_pointers[idx], ERR_NONE,
+                                                      (void *)(0x100 + idx), 1);
+        expect_function_call(mock_pool_allocator_allocate);
+    }
+
+    ret = i_pool_allocator_allocate_bulk(&interface, object_pointers, 3);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal((void *)0x102, object_pointers[2]);
+
+    // every object is freed even after one fails, and the first failure is returned
+    mock_pool_allocator_setup_deallocate_with_count(context, &object_pointers[0], ERR_NONE, NULL, 1);
+    mock_pool_allocator_setup_deallocate_with_count(context, &object_pointers[1], ERR_OUT_OF_BOUNDS, NULL, 1);
+    mock_pool_allocator_setup_deallocate_with_count(context, &object_pointers[2], ERR_NONE, NULL, 1);
+    expect_function_calls(mock_pool_allocator_deallocate, 3);
+
+    ret = i_pool_allocator_deallocate_bulk(&interface, object_pointers, 3);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+}
+
+static void test_bulk_fallback_failure_returns_objects(void ** state)
+{
+    (void)state;
+
+    void * object_pointers[3] = {};
+    ErrorCode_t ret;
+    IPoolAllocator_t interface;
+    void * context = (void *)0xDEADBEEF;
+
+    mock_pool_allocator_get_interface(&interface, context);
+
+    mock_pool_allocator_setup_allocate_with_count(context, &object_pointers[0], ERR_NONE, (void *)0x100, 1);
+    mock_pool_allocator_setup_allocate_with_count(context, &object_pointers[1], ERR_NONE, (void *)0x101, 1);
+    mock_pool_allocator_setup_allocate_with_count(context, &object_pointers[2], ERR_NO_MEM, NULL, 1);
+    expect_function_calls(mock_pool_allocator_allocate, 3);
+
+    // the two objects taken are given back, most recent first
+    mock_pool_allocator_setup_deallocate_with_count(context, &object_pointers[1], ERR_NONE, NULL, 1);
+    mock_pool_allocator_setup_deallocate_with_count(context, &object_pointers[0], ERR_NONE, NULL, 1);
+    expect_function_calls(mock_pool_allocator_deallocate, 2);
+
+    ret = i_pool_allocator_allocate_bulk(&interface, object_pointers, 3);
+    assert_int_equal(ERR_NO_MEM, ret);
+}
+
 int test_i_pool_allocator_run_tests(void)
 {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_allocation),
         cmocka_unit_test(test_deallocate),
         cmocka_unit_test(test_get_unused_count),
+        cmocka_unit_test(test_allocate_sized_not_implemented),
+        cmocka_unit_test(test_bulk_fallback),
+        cmocka_unit_test(test_bulk_fallback_failure_returns_objects),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
\ No newline at end of file
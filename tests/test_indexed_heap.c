@@ -0,0 +1,237 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include "test_indexed_heap.h"
+#include <cemb/indexed_heap.h>
+
+#define HEAP_ITEM_COUNT (10)
+#define STRESS_ITEM_COUNT (64)
+
+typedef struct TestTimer TestTimer_t;
+
+/**
+ * @brief A timer as the heap sees it, ordered by deadline.
+ */
+struct TestTimer
+{
+    uint32_t deadline;
+    IndexedHeapHandle_t handle;
+    bool scheduled;
+};
+
+/**
+ * @brief Min heap on deadlines, earliest timer at the root.
+ */
+static bool timer_compare(void const * const parent, void const * const child)
+{
+    return ((TestTimer_t const *)parent)->deadline > ((TestTimer_t const *)child)->deadline;
+}
+
+typedef struct TestIndexedHeapFixture TestIndexedHeapFixture_t;
+
+struct TestIndexedHeapFixture
+{
+    IndexedHeapEntry_t heap_storage[STRESS_ITEM_COUNT];
+    size_t position_storage[STRESS_ITEM_COUNT];
+    IndexedHeap_t heap;
+};
+
+static void test_init_fixture(TestIndexedHeapFixture_t * fixture, size_t element_count)
+{
+    IndexedHeapConfig_t config = {
+        .heap_storage = fixture->heap_storage,
+        .position_storage = fixture->position_storage,
+        .element_count = element_count,
+        .compare = timer_compare,
+    };
+    assert_int_equal(ERR_NONE, indexed_heap_init(&fixture->heap, &config));
+}
+
+/**
+ * @brief Pops every timer, checking the deadlines come out in order and only scheduled timers are returned.
+ */
+static void test_pop_all_in_order(TestIndexedHeapFixture_t * fixture, size_t expected_count)
+{
+    uint32_t previous_deadline = 0;
+    void * item;
+
+    for (size_t idx = 0; idx < expected_count; ++idx)
+    {
+        assert_int_equal(ERR_NONE, indexed_heap_pop(&fixture->heap, &item));
+        TestTimer_t * timer = item;
+        assert_true(timer->scheduled);
+        assert_true(timer->deadline >= previous_deadline);
+        previous_deadline = timer->deadline;
+        timer->scheduled = false;
+    }
+    assert_int_equal(ERR_EMPTY, indexed_heap_pop(&fixture->heap, &item));
+}
+
+static void test_bad_init(void ** state)
+{
+    (void)state;
+
+    TestIndexedHeapFixture_t fixture;
+    IndexedHeapConfig_t config = {
+        .heap_storage = fixture.heap_storage,
+        .position_storage = fixture.position_storage,
+        .element_count = 0,
+        .compare = timer_compare,
+    };
+
+    assert_int_equal(ERR_INVALID_ARG, indexed_heap_init(&fixture.heap, &config));
+}
+
+static void test_safe_deinit(void ** state)
+{
+    (void)state;
+
+    TestIndexedHeapFixture_t fixture;
+    TestTimer_t timer = {5, 0, false};
+    void * item = NULL;
+
+    test_init_fixture(&fixture, HEAP_ITEM_COUNT);
+    assert_int_equal(ERR_NONE, indexed_heap_push(&fixture.heap, &timer, &timer.handle));
+
+    indexed_heap_deinit(&fixture.heap);
+
+    assert_int_equal(ERR_NO_MEM, indexed_heap_push(&fixture.heap, &timer, NULL));
+    assert_int_equal(ERR_EMPTY, indexed_heap_peek(&fixture.heap, &item, NULL));
+    assert_int_equal(ERR_EMPTY, indexed_heap_pop(&fixture.heap, &item));
+    assert_int_equal(ERR_INVALID_ARG, indexed_heap_update_key(&fixture.heap, timer.handle, &timer));
+    assert_int_equal(ERR_INVALID_ARG, indexed_heap_remove(&fixture.heap, timer.handle, &item));
+}
+
+static void test_reschedule_and_cancel(void ** state)
+{
+    (void)state;
+
+    TestIndexedHeapFixture_t fixture;
+    TestTimer_t timers[HEAP_ITEM_COUNT];
+    IndexedHeapHandle_t handle;
+    void * item = NULL;
+
+    test_init_fixture(&fixture, HEAP_ITEM_COUNT);
+
+    for (size_t idx = 0; idx < HEAP_ITEM_COUNT; ++idx)
+    {
+        timers[idx] = (TestTimer_t){(uint32_t)(100 + (idx * 10)), 0, true};
+        assert_int_equal(ERR_NONE, indexed_heap_push(&fixture.heap, &timers[idx], &timers[idx].handle));
+    }
+    assert_int_equal(ERR_NO_MEM, indexed_heap_push(&fixture.heap, &timers[0], NULL));
+
+    // the last timer moves to the front, then the first moves to the back
+    timers[9].deadline = 1;
+    assert_int_equal(ERR_NONE, indexed_heap_update_key(&fixture.heap, timers[9].handle, &timers[9]));
+    assert_int_equal(ERR_NONE, indexed_heap_peek(&fixture.heap, &item, &handle));
+    assert_ptr_equal(&timers[9], item);
+    assert_int_equal(timers[9].handle, handle);
+
+    timers[0].deadline = 1000;
+    assert_int_equal(ERR_NONE, indexed_heap_update_key(&fixture.heap, timers[0].handle, &timers[0]));
+
+    // cancelling from the middle, the root and a leaf
+    assert_int_equal(ERR_NONE, indexed_heap_remove(&fixture.heap, timers[4].handle, &item));
+    assert_ptr_equal(&timers[4], item);
+    timers[4].scheduled = false;
+    assert_int_equal(ERR_NONE, indexed_heap_remove(&fixture.heap, timers[9].handle, &item));
+    assert_ptr_equal(&timers[9], item);
+    timers[9].scheduled = false;
+    assert_int_equal(ERR_NONE, indexed_heap_remove(&fixture.heap, timers[0].handle, NULL));
+    timers[0].scheduled = false;
+    assert_int_equal(HEAP_ITEM_COUNT - 3, indexed_heap_get_size(&fixture.heap));
+    assert_int_equal(3, indexed_heap_get_remaining(&fixture.heap));
+
+    // removed handles are no longer in the heap
+    assert_int_equal(ERR_INVALID_ARG, indexed_heap_remove(&fixture.heap, timers[4].handle, &item));
+    assert_int_equal(ERR_INVALID_ARG, indexed_heap_update_key(&fixture.heap, timers[0].handle, &timers[0]));
+    assert_int_equal(ERR_INVALID_ARG, indexed_heap_remove(&fixture.heap, HEAP_ITEM_COUNT, &item));
+
+    // a freed handle is reused for the next push
+    timers[4].deadline = 135;
+    timers[4].scheduled = true;
+    assert_int_equal(ERR_NONE, indexed_heap_push(&fixture.heap, &timers[4], &timers[4].handle));
+    assert_int_equal(ERR_NONE, indexed_heap_update_key(&fixture.heap, timers[4].handle, &timers[4]));
+
+    test_pop_all_in_order(&fixture, HEAP_ITEM_COUNT - 2);
+}
+
+/**
+ * @brief Mixes pushes, reschedules, cancels and pops, checking the root against a linear search of the scheduled
+ *        timers after every step.
+ */
+static void test_random_operations(void ** state)
+{
+    (void)state;
+
+    TestIndexedHeapFixture_t fixture;
+    TestTimer_t timers[STRESS_ITEM_COUNT] = {};
+    uint32_t random_state = 0x2545f491u;
+    size_t scheduled_count = 0;
+    void * item = NULL;
+
+    test_init_fixture(&fixture, STRESS_ITEM_COUNT);
+
+    for (size_t step = 0; step < 2000; ++step)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        TestTimer_t * timer = &timers[(random_state >> 8) % STRESS_ITEM_COUNT];
+        uint32_t deadline = (random_state >> 16) % 500;
+
+        if (!timer->scheduled)
+        {
+            timer->deadline = deadline;
+            timer->scheduled = true;
+            assert_int_equal(ERR_NONE, indexed_heap_push(&fixture.heap, timer, &timer->handle));
+            scheduled_count++;
+        }
+        else if ((random_state & 0x3) == 0)
+        {
+            assert_int_equal(ERR_NONE, indexed_heap_remove(&fixture.heap, timer->handle, &item));
+            assert_ptr_equal(timer, item);
+            timer->scheduled = false;
+            scheduled_count--;
+        }
+        else if ((random_state & 0x3) == 1)
+        {
+            assert_int_equal(ERR_NONE, indexed_heap_pop(&fixture.heap, &item));
+            ((TestTimer_t *)item)->scheduled = false;
+            scheduled_count--;
+        }
+        else
+        {
+            timer->deadline = deadline;
+            assert_int_equal(ERR_NONE, indexed_heap_update_key(&fixture.heap, timer->handle, timer));
+        }
+
+        assert_int_equal(scheduled_count, indexed_heap_get_size(&fixture.heap));
+        if (scheduled_count == 0) continue;
+
+        uint32_t earliest_deadline = UINT32_MAX;
+        for (size_t idx = 0; idx < STRESS_ITEM_COUNT; ++idx)
+        {
+            if (timers[idx].scheduled && (timers[idx].deadline < earliest_deadline))
+            {
+                earliest_deadline = timers[idx].deadline;
+            }
+        }
+        assert_int_equal(ERR_NONE, indexed_heap_peek(&fixture.heap, &item, NULL));
+        assert_int_equal(earliest_deadline, ((TestTimer_t *)item)->deadline);
+    }
+
+    test_pop_all_in_order(&fixture, scheduled_count);
+}
+
+int test_indexed_heap_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_bad_init),
+        cmocka_unit_test(test_safe_deinit),
+        cmocka_unit_test(test_reschedule_and_cancel),
+        cmocka_unit_test(test_random_operations),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+int test_indexed_heap_run_tests(void);
@@ -0,0 +1,336 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/concurrent_pool.h>
+#include <cemb/instrumented_pool.h>
+#include <cemb/static_pool.h>
+#include "test_instrumented_pool.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#define TEST_OBJECT_COUNT (4)
+#define TEST_OBJECT_SIZE_BYTES (sizeof(uint32_t))
+#define TEST_THREAD_COUNT (4)
+#define TEST_ALLOCATIONS_PER_THREAD (1u << 14)
+#define TEST_OBJECTS_HELD_PER_THREAD (2)
+
+typedef struct TestInstrumentedPoolFixture TestInstrumentedPoolFixture_t;
+
+/**
+ * @brief A static pool with its interface, which the instrumented pool wraps.
+ */
+struct TestInstrumentedPoolFixture
+{
+    uint8_t buffer[TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT];
+    void * allocation_stack[TEST_OBJECT_COUNT];
+    StaticPool_t pool;
+    IPoolAllocator_t pool_allocator;
+};
+
+static void test_init_fixture(TestInstrumentedPoolFixture_t * fixture, InstrumentedPoolConfig_t * config)
+{
+    StaticPoolConfig_t pool_config = {
+        .buffer = fixture->buffer,
+        .buffer_size = sizeof(fixture->buffer),
+        .allocation_stack = fixture->allocation_stack,
+        .object_count = TEST_OBJECT_COUNT,
+        .object_size = TEST_OBJECT_SIZE_BYTES,
+    };
+
+    assert_int_equal(ERR_NONE, static_pool_init(&fixture->pool, &pool_config));
+    assert_int_equal(ERR_NONE, static_pool_as_i_pool_allocator(&fixture->pool, &fixture->pool_allocator));
+
+    config->backing_allocator = &fixture->pool_allocator;
+    config->get_ticks = NULL;
+}
+
+static void test_correct_interface(void ** state)
+{
+    (void)state;
+
+    TestInstrumentedPoolFixture_t fixture;
+    InstrumentedPoolConfig_t config;
+    InstrumentedPool_t pool;
+    IPoolAllocator_t interface;
+    void * object = NULL;
+
+    test_init_fixture(&fixture, &config);
+    assert_int_equal(ERR_NONE, instrumented_pool_init(&pool, &config));
+
+    ErrorCode_t ret = instrumented_pool_as_i_pool_allocator(&pool, &interface);
+    assert_int_equal(ERR_NONE, ret);
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+    assert_ptr_equal(interface.context, &pool);
+    assert_ptr_equal(interface.allocate, instrumented_pool_allocate);
+    assert_ptr_equal(interface.deallocate, instrumented_pool_deallocate);
+    assert_ptr_equal(interface.get_available_count, instrumented_pool_get_available_count);
+    assert_ptr_equal(interface.allocate_sized, instrumented_pool_allocate_sized);
+#else
+    // without instrumentation the backing allocator is used directly
+    assert_memory_equal(&fixture.pool_allocator, &interface, sizeof(interface));
+#endif
+
+    ret = i_pool_allocator_allocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_OBJECT_COUNT - 1, i_pool_allocator_get_available_count(&interface));
+    ret = i_pool_allocator_deallocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+
+    instrumented_pool_deinit(&pool);
+}
+
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+
+static uint32_t test_ticks;
+static uint32_t test_tick_step;
+
+/**
+ * @brief Advances by the step on every read, so each allocation appears to take exactly the step.
+ */
+static uint32_t test_get_ticks(void)
+{
+    uint32_t ticks = test_ticks;
+    test_ticks += test_tick_step;
+    return ticks;
+}
+
+static void test_counts_and_high_water_mark(void ** state)
+{
+    (void)state;
+
+    TestInstrumentedPoolFixture_t fixture;
+    InstrumentedPoolConfig_t config;
+    InstrumentedPool_t pool;
+    InstrumentedPoolSnapshot_t snapshot;
+    void * objects[TEST_OBJECT_COUNT + 1] = {};
+    ErrorCode_t ret;
+
+    test_init_fixture(&fixture, &config);
+    assert_int_equal(ERR_NONE, instrumented_pool_init(&pool, &config));
+
+    for (size_t idx = 0; idx < 3; ++idx)
+    {
+        ret = instrumented_pool_allocate(&pool, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+    ret = instrumented_pool_deallocate(&pool, &objects[0]);
+    assert_int_equal(ERR_NONE, ret);
+
+    for (size_t idx = 3; idx < TEST_OBJECT_COUNT + 1; ++idx)
+    {
+        ret = instrumented_pool_allocate(&pool, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+
+    // all 4 objects are in use
+    ret = instrumented_pool_allocate(&pool, &objects[0]);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // a single size pool does not serve sized requests, which counts as a failure
+    ret = instrumented_pool_allocate_sized(&pool, TEST_OBJECT_SIZE_BYTES, &objects[0]);
+    assert_int_equal(ERR_NOT_IMPLEMENTED, ret);
+
+    ret = instrumented_pool_get_snapshot(&pool, &snapshot);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(5, snapshot.allocate_count);
+    assert_int_equal(2, snapshot.failure_count);
+    assert_int_equal(1, snapshot.deallocate_count);
+    assert_int_equal(4, snapshot.in_use_count);
+    assert_int_equal(4, snapshot.high_water_mark);
+
+    // a failed deallocation is not counted
+    void * stray = NULL;
+    ret = instrumented_pool_deallocate(&pool, &stray);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    for (size_t idx = 1; idx < 3; ++idx)
+    {
+        ret = instrumented_pool_deallocate(&pool, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+
+    // the peak stays until it is reset
+    instrumented_pool_get_snapshot(&pool, &snapshot);
+    assert_int_equal(3, snapshot.deallocate_count);
+    assert_int_equal(2, snapshot.in_use_count);
+    assert_int_equal(4, snapshot.high_water_mark);
+
+    instrumented_pool_reset_high_water_mark(&pool);
+    instrumented_pool_get_snapshot(&pool, &snapshot);
+    assert_int_equal(2, snapshot.high_water_mark);
+
+    ret = instrumented_pool_allocate(&pool, &objects[0]);
+    assert_int_equal(ERR_NONE, ret);
+    instrumented_pool_get_snapshot(&pool, &snapshot);
+    assert_int_equal(3, snapshot.high_water_mark);
+
+    instrumented_pool_deinit(&pool);
+}
+
+static void test_latency_histogram(void ** state)
+{
+    (void)state;
+
+    TestInstrumentedPoolFixture_t fixture;
+    InstrumentedPoolConfig_t config;
+    InstrumentedPool_t pool;
+    InstrumentedPoolSnapshot_t snapshot;
+    void * object = NULL;
+
+    test_init_fixture(&fixture, &config);
+    config.get_ticks = test_get_ticks;
+    assert_int_equal(ERR_NONE, instrumented_pool_init(&pool, &config));
+
+    // the timer wraps part way through, which must not affect the measured time
+    uint32_t const steps[] = {0, 1, 5, 7, 1u << 20};
+    size_t const expected_buckets[] = {0, 1, 3, 3, INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT - 1};
+    test_ticks = UINT32_MAX - 8;
+
+    for (size_t idx = 0; idx < sizeof(steps) / sizeof(steps[0]); ++idx)
+    {
+        test_tick_step = steps[idx];
+        assert_int_equal(ERR_NONE, instrumented_pool_allocate(&pool, &object));
+        assert_int_equal(ERR_NONE, instrumented_pool_deallocate(&pool, &object));
+    }
+
+    instrumented_pool_get_snapshot(&pool, &snapshot);
+
+    size_t expected_histogram[INSTRUMENTED_POOL_HISTOGRAM_BUCKET_COUNT] = {};
+    for (size_t idx = 0; idx < sizeof(expected_buckets) / sizeof(expected_buckets[0]); ++idx)
+    {
+        expected_histogram[expected_buckets[idx]]++;
+    }
+    assert_memory_equal(expected_histogram, snapshot.latency_histogram, sizeof(expected_histogram));
+
+    instrumented_pool_deinit(&pool);
+}
+
+/**
+ * @brief Holds a few objects at a time, so the threads between them keep the pool close to empty.
+ */
+static void * test_allocate_thread(void * context)
+{
+    InstrumentedPool_t * pool = context;
+    void * held[TEST_OBJECTS_HELD_PER_THREAD];
+
+    for (size_t iteration = 0; iteration < TEST_ALLOCATIONS_PER_THREAD; ++iteration)
+    {
+        for (size_t idx = 0; idx < TEST_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            while (instrumented_pool_allocate(pool, &held[idx]) != ERR_NONE)
+            {
+                sched_yield();
+            }
+        }
+        for (size_t idx = 0; idx < TEST_OBJECTS_HELD_PER_THREAD; ++idx)
+        {
+            instrumented_pool_deallocate(pool, &held[idx]);
+        }
+    }
+    return NULL;
+}
+
+static void test_threaded_high_water_mark(void ** state)
+{
+    (void)state;
+
+    static uint32_t buffer[TEST_OBJECT_COUNT];
+    static atomic_size_t link_buffer[TEST_OBJECT_COUNT];
+    ConcurrentPool_t backing_pool;
+    IPoolAllocator_t backing_allocator;
+    InstrumentedPoolConfig_t config = {
+        .backing_allocator = &backing_allocator,
+        .get_ticks = NULL,
+    };
+    InstrumentedPool_t pool;
+    InstrumentedPoolSnapshot_t snapshot;
+    pthread_t threads[TEST_THREAD_COUNT];
+
+    ConcurrentPoolConfig_t backing_config = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .object_size = TEST_OBJECT_SIZE_BYTES,
+        .object_count = TEST_OBJECT_COUNT,
+        .link_buffer = link_buffer,
+    };
+    assert_int_equal(ERR_NONE, concurrent_pool_init(&backing_pool, &backing_config));
+    assert_int_equal(ERR_NONE, concurrent_pool_as_i_pool_allocator(&backing_pool, &backing_allocator));
+    assert_int_equal(ERR_NONE, instrumented_pool_init(&pool, &config));
+
+    for (size_t idx = 0; idx < TEST_THREAD_COUNT; ++idx)
+    {
+        assert_int_equal(0, pthread_create(&threads[idx], NULL, test_allocate_thread, &pool));
+    }
+
+    // the peak is sampled while the threads run, as a wrapped count would stick at the peak
+    for (size_t idx = 0; idx < TEST_ALLOCATIONS_PER_THREAD; ++idx)
+    {
+        instrumented_pool_get_snapshot(&pool, &snapshot);
+        assert_true(snapshot.high_water_mark <= TEST_OBJECT_COUNT);
+        assert_true(snapshot.in_use_count <= TEST_OBJECT_COUNT);
+        sched_yield();
+    }
+
+    for (size_t idx = 0; idx < TEST_THREAD_COUNT; ++idx)
+    {
+        assert_int_equal(0, pthread_join(threads[idx], NULL));
+    }
+
+    instrumented_pool_get_snapshot(&pool, &snapshot);
+    assert_int_equal(TEST_THREAD_COUNT * TEST_ALLOCATIONS_PER_THREAD * TEST_OBJECTS_HELD_PER_THREAD,
+                     snapshot.allocate_count);
+    assert_int_equal(snapshot.allocate_count, snapshot.deallocate_count);
+    assert_int_equal(0, snapshot.in_use_count);
+    assert_true(snapshot.high_water_mark <= TEST_OBJECT_COUNT);
+    assert_int_equal(TEST_OBJECT_COUNT, instrumented_pool_get_available_count(&pool));
+
+    instrumented_pool_deinit(&pool);
+    concurrent_pool_deinit(&backing_pool);
+}
+
+#else
+
+static void test_snapshot_not_implemented(void ** state)
+{
+    (void)state;
+
+    TestInstrumentedPoolFixture_t fixture;
+    InstrumentedPoolConfig_t config;
+    InstrumentedPool_t pool;
+    InstrumentedPoolSnapshot_t snapshot;
+    void * object = NULL;
+
+    test_init_fixture(&fixture, &config);
+    assert_int_equal(ERR_NONE, instrumented_pool_init(&pool, &config));
+
+    assert_int_equal(ERR_NONE, instrumented_pool_allocate(&pool, &object));
+
+    ErrorCode_t ret = instrumented_pool_get_snapshot(&pool, &snapshot);
+    assert_int_equal(ERR_NOT_IMPLEMENTED, ret);
+    assert_int_equal(0, snapshot.allocate_count);
+    assert_int_equal(0, snapshot.high_water_mark);
+
+    instrumented_pool_deinit(&pool);
+}
+
+#endif
+
+int test_instrumented_pool_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_interface),
+#ifdef CEMB_CFG_POOL_INSTRUMENTATION
+        cmocka_unit_test(test_counts_and_high_water_mark),
+        cmocka_unit_test(test_latency_histogram),
+        cmocka_unit_test(test_threaded_high_water_mark),
+#else
+        cmocka_unit_test(test_snapshot_not_implemented),
+#endif
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
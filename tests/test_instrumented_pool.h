@@ -0,0 +1,3 @@
+#pragma once
+
+int test_instrumented_pool_run_tests(void);
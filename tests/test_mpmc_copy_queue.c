@@ -0,0 +1,253 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/mpmc_copy_queue.h>
+#include "test_mpmc_copy_queue.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#define ITEMS_IN_TEST_QUEUE (16)
+#define THREADS_PER_SIDE (4)
+#define ITEMS_PER_PRODUCER (1u << 15)
+
+static void test_correct_fifo_ordering(void ** state)
+{
+    (void)state;
+
+    static uint32_t queue_buffer[ITEMS_IN_TEST_QUEUE];
+    static atomic_size_t sequence_buffer[ITEMS_IN_TEST_QUEUE];
+
+    MpmcCopyQueueConfig_t config = {
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = sizeof(uint32_t),
+        .sequence_buffer = sequence_buffer,
+    };
+
+    MpmcCopyQueue_t queue;
+    ErrorCode_t result;
+    uint32_t output;
+
+    result = mpmc_copy_queue_init(&queue, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    result = mpmc_copy_queue_dequeue(&queue, &output);
+    assert_int_equal(ERR_EMPTY, result);
+
+    // several laps, so slots are reused
+    for (uint32_t lap = 0; lap < 3; ++lap)
+    {
+        for (uint32_t idx = 0; idx < ITEMS_IN_TEST_QUEUE; ++idx)
+        {
+            uint32_t input = (lap * ITEMS_IN_TEST_QUEUE) + idx;
+            result = mpmc_copy_queue_enqueue(&queue, &input);
+            assert_int_equal(ERR_NONE, result);
+            assert_int_equal(idx + 1, mpmc_copy_queue_get_size(&queue));
+        }
+
+        result = mpmc_copy_queue_enqueue(&queue, &output);
+        assert_int_equal(ERR_NO_MEM, result);
+
+        for (uint32_t idx = 0; idx < ITEMS_IN_TEST_QUEUE; ++idx)
+        {
+            result = mpmc_copy_queue_dequeue(&queue, &output);
+            assert_int_equal(ERR_NONE, result);
+            assert_int_equal((lap * ITEMS_IN_TEST_QUEUE) + idx, output);
+        }
+
+        result = mpmc_copy_queue_dequeue(&queue, &output);
+        assert_int_equal(ERR_EMPTY, result);
+    }
+}
+
+typedef struct TestMpmcThreadArgs TestMpmcThreadArgs_t;
+
+struct TestMpmcThreadArgs
+{
+    MpmcCopyQueue_t * queue;
+    uint32_t producer_id;
+    uint64_t sum;
+    size_t count;
+    uint32_t last_seen[THREADS_PER_SIDE];
+    size_t order_errors;
+};
+
+static void * test_mpmc_producer(void * context)
+{
+    TestMpmcThreadArgs_t * args = context;
+
+    // each element encodes the producer in the top byte and a per producer sequence in the rest
+    for (uint32_t idx = 1; idx <= ITEMS_PER_PRODUCER;)
+    {
+        uint32_t element = (args->producer_id << 24) | idx;
+        if (mpmc_copy_queue_enqueue(args->queue, &element) == ERR_NONE)
+        {
+            idx++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * test_mpmc_consumer(void * context)
+{
+    TestMpmcThreadArgs_t * args = context;
+    uint32_t element;
+
+    while (args->count < ITEMS_PER_PRODUCER)
+    {
+        if (mpmc_copy_queue_dequeue(args->queue, &element) == ERR_NONE)
+        {
+            uint32_t producer_id = element >> 24;
+            uint32_t sequence = element & 0xFFFFFF;
+            // elements from any one producer must still be seen in order by any one consumer
+            if (sequence <= args->last_seen[producer_id]) args->order_errors++;
+            args->last_seen[producer_id] = sequence;
+            args->sum += sequence;
+            args->count++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Every element from every producer must be consumed exactly once.
+ */
+static void test_threaded_no_loss(void ** state)
+{
+    (void)state;
+
+    static uint32_t queue_buffer[ITEMS_IN_TEST_QUEUE];
+    static atomic_size_t sequence_buffer[ITEMS_IN_TEST_QUEUE];
+    static TestMpmcThreadArgs_t producer_args[THREADS_PER_SIDE];
+    static TestMpmcThreadArgs_t consumer_args[THREADS_PER_SIDE];
+
+    MpmcCopyQueueConfig_t config = {
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = sizeof(uint32_t),
+        .sequence_buffer = sequence_buffer,
+    };
+
+    MpmcCopyQueue_t queue;
+    ErrorCode_t result;
+    pthread_t producers[THREADS_PER_SIDE];
+    pthread_t consumers[THREADS_PER_SIDE];
+
+    result = mpmc_copy_queue_init(&queue, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    memset(producer_args, 0, sizeof(producer_args));
+    memset(consumer_args, 0, sizeof(consumer_args));
+
+    for (uint32_t idx = 0; idx < THREADS_PER_SIDE; ++idx)
+    {
+        consumer_args[idx].queue = &queue;
+        producer_args[idx].queue = &queue;
+        producer_args[idx].producer_id = idx;
+        assert_int_equal(0, pthread_create(&consumers[idx], NULL, test_mpmc_consumer, &consumer_args[idx]));
+        assert_int_equal(0, pthread_create(&producers[idx], NULL, test_mpmc_producer, &producer_args[idx]));
+    }
+
+    uint64_t sum = 0;
+    size_t order_errors = 0;
+    for (size_t idx = 0; idx < THREADS_PER_SIDE; ++idx)
+    {
+        pthread_join(producers[idx], NULL);
+        pthread_join(consumers[idx], NULL);
+        sum += consumer_args[idx].sum;
+        order_errors += consumer_args[idx].order_errors;
+    }
+
+    uint64_t expected_sum = (uint64_t)THREADS_PER_SIDE * ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER + 1) / 2;
+    assert_int_equal(expected_sum, sum);
+    assert_int_equal(0, order_errors);
+    assert_int_equal(0, mpmc_copy_queue_get_size(&queue));
+}
+
+static void test_bad_config(void ** state)
+{
+    (void)state;
+
+    static uint32_t queue_buffer[ITEMS_IN_TEST_QUEUE];
+    static atomic_size_t sequence_buffer[ITEMS_IN_TEST_QUEUE];
+    MpmcCopyQueueConfig_t base_config = {
+        .queue_buffer = (uint8_t *)queue_buffer,
+        .queue_size = sizeof(queue_buffer),
+        .element_count = ITEMS_IN_TEST_QUEUE,
+        .element_size = sizeof(uint32_t),
+        .sequence_buffer = sequence_buffer,
+    };
+    MpmcCopyQueueConfig_t test_config = base_config;
+    MpmcCopyQueue_t queue;
+    ErrorCode_t result;
+
+    test_config = base_config;
+    test_config.element_count = ITEMS_IN_TEST_QUEUE - 1;
+    result = mpmc_copy_queue_init(&queue, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    test_config = base_config;
+    test_config.element_count = 1;
+    result = mpmc_copy_queue_init(&queue, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    test_config = base_config;
+    test_config.element_size = sizeof(uint32_t) + 1;
+    result = mpmc_copy_queue_init(&queue, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    test_config = base_config;
+    test_config.queue_size = 0;
+    result = mpmc_copy_queue_init(&queue, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    test_config = base_config;
+    test_config.element_size = 0;
+    result = mpmc_copy_queue_init(&queue, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+}
+
+static void test_deinit_prevents_actions(void ** state)
+{
+    (void)state;
+
+    MpmcCopyQueue_t queue;
+    uint32_t dummy = 0;
+    ErrorCode_t result;
+
+    mpmc_copy_queue_deinit(&queue);
+
+    result = mpmc_copy_queue_enqueue(&queue, &dummy);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    result = mpmc_copy_queue_dequeue(&queue, &dummy);
+    assert_int_equal(ERR_EMPTY, result);
+
+    assert_int_equal(0, mpmc_copy_queue_get_size(&queue));
+}
+
+int test_mpmc_copy_queue_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_fifo_ordering),
+        cmocka_unit_test(test_threaded_no_loss),
+        cmocka_unit_test(test_bad_config),
+        cmocka_unit_test(test_deinit_prevents_actions),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
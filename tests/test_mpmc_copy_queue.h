@@ -0,0 +1,3 @@
+#pragma once
+
+int test_mpmc_copy_queue_run_tests(void);
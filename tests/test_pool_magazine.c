@@ -0,0 +1,243 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/pool_magazine.h>
+#include <cemb/static_pool.h>
+#include "test_pool_magazine.h"
+
+#define TEST_OBJECT_COUNT (16)
+#define TEST_OBJECT_SIZE_BYTES (sizeof(uint32_t))
+#define TEST_MAGAZINE_SIZE (4)
+#define TEST_BATCH_SIZE (2)
+
+typedef struct TestPoolMagazineFixture TestPoolMagazineFixture_t;
+
+/**
+ * @brief A static pool with its interface, the magazine refills from and flushes to this pool.
+ */
+struct TestPoolMagazineFixture
+{
+    uint8_t buffer[TEST_OBJECT_SIZE_BYTES * TEST_OBJECT_COUNT];
+    void * allocation_stack[TEST_OBJECT_COUNT];
+    void * object_buffer[TEST_MAGAZINE_SIZE];
+    StaticPool_t pool;
+    IPoolAllocator_t pool_allocator;
+};
+
+static void test_init_fixture(TestPoolMagazineFixture_t * fixture, PoolMagazineConfig_t * config)
+{
+    StaticPoolConfig_t pool_config = {
+        .buffer = fixture->buffer,
+        .buffer_size = sizeof(fixture->buffer),
+        .allocation_stack = fixture->allocation_stack,
+        .object_count = TEST_OBJECT_COUNT,
+        .object_size = TEST_OBJECT_SIZE_BYTES,
+    };
+
+    assert_int_equal(ERR_NONE, static_pool_init(&fixture->pool, &pool_config));
+    assert_int_equal(ERR_NONE, static_pool_as_i_pool_allocator(&fixture->pool, &fixture->pool_allocator));
+
+    config->backing_allocator = &fixture->pool_allocator;
+    config->object_buffer = fixture->object_buffer;
+    config->magazine_size = TEST_MAGAZINE_SIZE;
+    config->batch_size = TEST_BATCH_SIZE;
+}
+
+static void test_correct_interface(void ** state)
+{
+    (void)state;
+
+    TestPoolMagazineFixture_t fixture;
+    PoolMagazineConfig_t config;
+    PoolMagazine_t magazine;
+    IPoolAllocator_t interface;
+
+    test_init_fixture(&fixture, &config);
+    assert_int_equal(ERR_NONE, pool_magazine_init(&magazine, &config));
+
+    ErrorCode_t ret = pool_magazine_as_i_pool_allocator(&magazine, &interface);
+    assert_int_equal(ERR_NONE, ret);
+
+    assert_ptr_equal(interface.context, &magazine);
+    assert_ptr_equal(interface.allocate, pool_magazine_allocate);
+    assert_ptr_equal(interface.deallocate, pool_magazine_deallocate);
+    assert_ptr_equal(interface.get_available_count, pool_magazine_get_available_count);
+    assert_ptr_equal(NULL, interface.allocate_sized);
+
+    pool_magazine_deinit(&magazine);
+}
+
+static void test_invalid_configs(void ** state)
+{
+    (void)state;
+
+    TestPoolMagazineFixture_t fixture;
+    PoolMagazineConfig_t config;
+    PoolMagazineConfig_t test_config;
+    PoolMagazine_t magazine;
+    ErrorCode_t ret;
+
+    test_init_fixture(&fixture, &config);
+
+    test_config = config;
+    test_config.magazine_size = 0;
+    ret = pool_magazine_init(&magazine, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.batch_size = 0;
+    ret = pool_magazine_init(&magazine, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.batch_size = TEST_MAGAZINE_SIZE + 1;
+    ret = pool_magazine_init(&magazine, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+}
+
+static void test_refills_and_flushes_in_batches(void ** state)
+{
+    (void)state;
+
+    TestPoolMagazineFixture_t fixture;
+    PoolMagazineConfig_t config;
+    PoolMagazine_t magazine;
+    PoolMagazineStats_t stats;
+    void * object_pointers[TEST_OBJECT_COUNT] = {};
+    void * token = NULL;
+    ErrorCode_t ret;
+
+    test_init_fixture(&fixture, &config);
+    assert_int_equal(ERR_NONE, pool_magazine_init(&magazine, &config));
+    assert_int_equal(0, pool_magazine_get_cached_count(&magazine));
+    assert_int_equal(TEST_OBJECT_COUNT, pool_magazine_get_available_count(&magazine));
+
+    // the first allocation pulls a batch, the second is served from the magazine
+    ret = pool_magazine_allocate(&magazine, &object_pointers[0]);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BATCH_SIZE - 1, pool_magazine_get_cached_count(&magazine));
+    assert_int_equal(TEST_OBJECT_COUNT - TEST_BATCH_SIZE, static_pool_get_available_count(&fixture.pool));
+    assert_int_equal(TEST_OBJECT_COUNT - 1, pool_magazine_get_available_count(&magazine));
+
+    for (size_t idx = 1; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = pool_magazine_allocate(&magazine, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(TEST_OBJECT_COUNT - 1 - idx, pool_magazine_get_available_count(&magazine));
+    }
+
+    ret = pool_magazine_allocate(&magazine, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    pool_magazine_get_stats(&magazine, &stats);
+    assert_int_equal(TEST_OBJECT_COUNT, stats.allocate_count);
+    assert_int_equal(TEST_OBJECT_COUNT / TEST_BATCH_SIZE, stats.refill_count);
+    assert_int_equal(0, stats.flush_count);
+
+    ret = pool_magazine_deallocate(&magazine, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    // the magazine fills, then each further batch of frees flushes once
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = pool_magazine_deallocate(&magazine, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(NULL, object_pointers[idx]);
+        assert_int_equal(idx + 1, pool_magazine_get_available_count(&magazine));
+    }
+
+    pool_magazine_get_stats(&magazine, &stats);
+    assert_int_equal(TEST_OBJECT_COUNT, stats.deallocate_count);
+    assert_int_equal((TEST_OBJECT_COUNT - TEST_MAGAZINE_SIZE) / TEST_BATCH_SIZE, stats.flush_count);
+    assert_int_equal(TEST_MAGAZINE_SIZE, pool_magazine_get_cached_count(&magazine));
+
+    pool_magazine_flush(&magazine);
+    assert_int_equal(0, pool_magazine_get_cached_count(&magazine));
+    assert_int_equal(TEST_OBJECT_COUNT, static_pool_get_available_count(&fixture.pool));
+}
+
+static void test_refills_what_is_left(void ** state)
+{
+    (void)state;
+
+    TestPoolMagazineFixture_t fixture;
+    PoolMagazineConfig_t config;
+    PoolMagazine_t magazine;
+    PoolMagazineStats_t stats;
+    void * object_pointers[TEST_OBJECT_COUNT] = {};
+    void * token = NULL;
+    ErrorCode_t ret;
+
+    test_init_fixture(&fixture, &config);
+    assert_int_equal(ERR_NONE, pool_magazine_init(&magazine, &config));
+
+    // leave less than a batch in the backing pool, so the bulk refill cannot be served
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT - 1; ++idx)
+    {
+        assert_int_equal(ERR_NONE, static_pool_allocate(&fixture.pool, &object_pointers[idx]));
+    }
+
+    ret = pool_magazine_allocate(&magazine, &token);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_not_equal(NULL, token);
+    assert_int_equal(0, pool_magazine_get_cached_count(&magazine));
+    assert_int_equal(0, static_pool_get_available_count(&fixture.pool));
+
+    pool_magazine_get_stats(&magazine, &stats);
+    assert_int_equal(1, stats.refill_count);
+
+    ret = pool_magazine_allocate(&magazine, &object_pointers[TEST_OBJECT_COUNT - 1]);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    assert_int_equal(ERR_NONE, pool_magazine_deallocate(&magazine, &token));
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT - 1; ++idx)
+    {
+        assert_int_equal(ERR_NONE, static_pool_deallocate(&fixture.pool, &object_pointers[idx]));
+    }
+    pool_magazine_deinit(&magazine);
+    assert_int_equal(TEST_OBJECT_COUNT, static_pool_get_available_count(&fixture.pool));
+}
+
+static void test_deinit_returns_objects(void ** state)
+{
+    (void)state;
+
+    TestPoolMagazineFixture_t fixture;
+    PoolMagazineConfig_t config;
+    PoolMagazine_t magazine;
+    void * token = NULL;
+    ErrorCode_t ret;
+
+    test_init_fixture(&fixture, &config);
+    assert_int_equal(ERR_NONE, pool_magazine_init(&magazine, &config));
+
+    ret = pool_magazine_allocate(&magazine, &token);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_BATCH_SIZE - 1, pool_magazine_get_cached_count(&magazine));
+
+    pool_magazine_deinit(&magazine);
+    assert_int_equal(TEST_OBJECT_COUNT - 1, static_pool_get_available_count(&fixture.pool));
+
+    // nothing is cached after deinit, objects freed later go straight back to the backing pool
+    ret = pool_magazine_deallocate(&magazine, &token);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_OBJECT_COUNT, static_pool_get_available_count(&fixture.pool));
+
+    ret = pool_magazine_allocate(&magazine, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+}
+
+int test_pool_magazine_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_interface),
+        cmocka_unit_test(test_invalid_configs),
+        cmocka_unit_test(test_refills_and_flushes_in_batches),
+        cmocka_unit_test(test_refills_what_is_left),
+        cmocka_unit_test(test_deinit_returns_objects),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+int test_pool_magazine_run_tests(void);
@@ -73,11 +73,52 @@ static void test_insert(void ** state)
 
 }
 
+static void test_bulk_push_pop(void ** state)
+{
+    (void)state;
+
+    PtrStack_t stack;
+    void * stack_buffer[4];
+    void * values[4] = {(void *)0xBEEF, (void *)0xDEAD, (void *)0xCAFE, (void *)0xFEED};
+    void * popped[4] = {};
+    ErrorCode_t ret;
+
+    ret = ptr_stack_init(&stack, stack_buffer, 4);
+    assert_int_equal(ERR_NONE, ret);
+
+    ret = ptr_stack_push_bulk(&stack, values, 3);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(1, ptr_stack_get_remaining_count(&stack));
+
+    // a run that does not fit is not partially pushed
+    ret = ptr_stack_push_bulk(&stack, values, 2);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(1, ptr_stack_get_remaining_count(&stack));
+
+    // single and bulk operations share the same order
+    ret = ptr_stack_push(&stack, values[3]);
+    assert_int_equal(ERR_NONE, ret);
+    ret = ptr_stack_pop_bulk(&stack, popped, 2);
+    assert_int_equal(ERR_NONE, ret);
+    assert_memory_equal(&values[2], popped, 2 * sizeof(void *));
+
+    ret = ptr_stack_pop_bulk(&stack, popped, 3);
+    assert_int_equal(ERR_EMPTY, ret);
+    assert_int_equal(2, ptr_stack_get_remaining_count(&stack));
+
+    ret = ptr_stack_pop(&stack, &popped[0]);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(values[1], popped[0]);
+
+    ptr_stack_deinit(&stack);
+}
+
 int test_ptr_stack_run_tests(void)
 {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_bad_init),
         cmocka_unit_test(test_insert),
+        cmocka_unit_test(test_bulk_push_pop),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
\ No newline at end of file
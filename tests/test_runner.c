@@ -1,38 +1,70 @@
+#include "test_arena.h"
 #include "test_bit_ops.h"
+#include "test_bitmap_pool.h"
+#include "test_blocking_copy_queue.h"
 #include "test_bounded_heap.h"
+#include "test_buddy_allocator.h"
 #include "test_bsearch_iter.h"
 #include "test_circular_buffer.h"
+#include "test_concurrent_pool.h"
 #include "test_copy_queue.h"
 #include "test_fast_circular_buffer.h"
 #include "test_i_pool_allocator.h"
+#include "test_indexed_heap.h"
+#include "test_instrumented_pool.h"
 #include "test_le_pack.h"
+#include "test_mpmc_copy_queue.h"
 #include "test_numeric_ops.h"
 #include "test_pack.h"
+#include "test_pool_magazine.h"
 #include "test_ptr_stack.h"
 #include "test_simple_fsm.h"
+#include "test_slab_allocator.h"
+#include "test_spsc_fast_circular_buffer.h"
 #include "test_static_event_publisher.h"
 #include "test_static_pool.h"
+#include "test_tlsf_allocator.h"
+#include "test_top_k.h"
+#include "test_typed_bounded_heap.h"
+#include "test_typed_copy_queue.h"
 
 
 int main()
 {
     int result = 0;
 
+    result |= test_arena_run_tests();
     result |= test_bit_ops_run_tests();
+    result |= test_bitmap_pool_run_tests();
+#ifdef CEMB_CFG_PRODUCE_BLOCKING_QUEUE
+    result |= test_blocking_copy_queue_run_tests();
+#endif
     result |= test_bounded_heap_run_tests();
+    result |= test_buddy_allocator_run_tests();
     result |= test_bsearch_iter_tests();
     result |= test_circular_buffer_run_tests();
+    result |= test_concurrent_pool_run_tests();
     result |= test_copy_queue_run_tests();
     result |= test_fast_circular_buffer_run_tests();
     result |= test_i_pool_allocator_run_tests();
+    result |= test_indexed_heap_run_tests();
+    result |= test_instrumented_pool_run_tests();
     result |= test_le_pack_run_tests();
+    result |= test_mpmc_copy_queue_run_tests();
     result |= test_numeric_ops_run_tests();
     result |= test_pack_run_tests();
+    result |= test_pool_magazine_run_tests();
     result |= test_circular_buffer_run_tests();
     result |= test_ptr_stack_run_tests();
     result |= test_simple_fsm_run_tests();
+    result |= test_slab_allocator_run_tests();
+    result |= test_spsc_fast_circular_buffer_run_tests();
     result |= test_static_event_publisher_run_tests();
     result |= test_static_pool_run_tests();
+    result |= test_tlsf_allocator_run_tests();
+    result |= test_top_k_run_tests();
+    result |= test_typed_bounded_heap_run_tests();
+    result |= test_typed_copy_queue_run_tests();
 
     return result;
 }
\ No newline at end of file
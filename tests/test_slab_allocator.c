@@ -0,0 +1,225 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/slab_allocator.h>
+#include "test_slab_allocator.h"
+
+#define TEST_SIZE_CLASS_COUNT (3)
+#define TEST_MAX_OBJECT_SIZE (64)
+#define TEST_BUFFER_SIZE ((8 * 4) + (32 * 2) + (64 * 2))
+
+typedef struct TestSlabFixture TestSlabFixture_t;
+
+/**
+ * @brief Storage for a slab with 8, 32 and 64 byte classes, the 32 byte class uses the intrusive free list.
+ */
+struct TestSlabFixture
+{
+    _Alignas(max_align_t) uint8_t buffer[TEST_BUFFER_SIZE];
+    void * small_stack[4];
+    void * large_stack[2];
+    SlabSizeClassConfig_t size_classes[TEST_SIZE_CLASS_COUNT];
+    StaticPool_t pools[TEST_SIZE_CLASS_COUNT];
+    uint8_t lookup_table[SLAB_ALLOCATOR_LOOKUP_TABLE_SIZE(TEST_MAX_OBJECT_SIZE)];
+};
+
+static SlabAllocatorConfig_t test_get_config(TestSlabFixture_t * fixture)
+{
+    fixture->size_classes[0] = (SlabSizeClassConfig_t){8, 4, fixture->small_stack};
+    fixture->size_classes[1] = (SlabSizeClassConfig_t){32, 2, NULL};
+    fixture->size_classes[2] = (SlabSizeClassConfig_t){64, 2, fixture->large_stack};
+
+    SlabAllocatorConfig_t config = {
+        .buffer = fixture->buffer,
+        .buffer_size = sizeof(fixture->buffer),
+        .size_classes = fixture->size_classes,
+        .pools = fixture->pools,
+        .size_class_count = TEST_SIZE_CLASS_COUNT,
+        .lookup_table = fixture->lookup_table,
+        .lookup_table_size = sizeof(fixture->lookup_table),
+    };
+    return config;
+}
+
+/**
+ * @brief Gets the size of the class an object was allocated from, by the region it is in.
+ */
+static size_t test_get_object_class_size(TestSlabFixture_t * fixture, void * object)
+{
+    for (size_t idx = 0; idx < TEST_SIZE_CLASS_COUNT; ++idx)
+    {
+        uint8_t * region = fixture->pools[idx].config.buffer;
+        if (((uint8_t *)object >= region) && ((uint8_t *)object < &region[fixture->pools[idx].config.buffer_size]))
+        {
+            return fixture->size_classes[idx].object_size;
+        }
+    }
+    return 0;
+}
+
+static void test_correct_interface(void ** state)
+{
+    (void)state;
+
+    TestSlabFixture_t fixture;
+    SlabAllocatorConfig_t config = test_get_config(&fixture);
+    SlabAllocator_t slab;
+    IPoolAllocator_t interface;
+    void * object = NULL;
+
+    assert_int_equal(ERR_NONE, slab_allocator_init(&slab, &config));
+
+    ErrorCode_t ret = slab_allocator_as_i_pool_allocator(&slab, &interface);
+    assert_int_equal(ERR_NONE, ret);
+
+    assert_ptr_equal(interface.context, &slab);
+    assert_ptr_equal(interface.allocate, slab_allocator_allocate);
+    assert_ptr_equal(interface.deallocate, slab_allocator_deallocate);
+    assert_ptr_equal(interface.get_available_count, slab_allocator_get_available_count);
+    assert_ptr_equal(interface.allocate_sized, slab_allocator_allocate_sized);
+
+    // the unsized allocate serves the largest class
+    ret = i_pool_allocator_allocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(64, test_get_object_class_size(&fixture, object));
+
+    ret = i_pool_allocator_allocate_sized(&interface, 20, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(32, test_get_object_class_size(&fixture, object));
+
+    slab_allocator_deinit(&slab);
+}
+
+static void test_invalid_configs(void ** state)
+{
+    (void)state;
+
+    TestSlabFixture_t fixture;
+    SlabAllocatorConfig_t config = test_get_config(&fixture);
+    SlabAllocatorConfig_t test_config;
+    SlabAllocator_t slab;
+    ErrorCode_t ret;
+
+    test_config = config;
+    test_config.buffer_size = TEST_BUFFER_SIZE - 1;
+    ret = slab_allocator_init(&slab, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.lookup_table_size = SLAB_ALLOCATOR_LOOKUP_TABLE_SIZE(TEST_MAX_OBJECT_SIZE) - 1;
+    ret = slab_allocator_init(&slab, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.size_class_count = 0;
+    ret = slab_allocator_init(&slab, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    // sizes must be ascending and a multiple of the granularity
+    fixture.size_classes[1].object_size = 8;
+    ret = slab_allocator_init(&slab, &config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    fixture.size_classes[1].object_size = 30;
+    ret = slab_allocator_init(&slab, &config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+}
+
+static void test_size_class_selection(void ** state)
+{
+    (void)state;
+
+    TestSlabFixture_t fixture;
+    SlabAllocatorConfig_t config = test_get_config(&fixture);
+    SlabAllocator_t slab;
+    void * object = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, slab_allocator_init(&slab, &config));
+    assert_int_equal(8, slab_allocator_get_available_count(&slab));
+
+    size_t const sizes[] = {0, 1, 8, 9, 32, 33, 64};
+    size_t const expected_class_sizes[] = {8, 8, 8, 32, 32, 64, 64};
+
+    for (size_t idx = 0; idx < sizeof(sizes) / sizeof(sizes[0]); ++idx)
+    {
+        ret = slab_allocator_allocate_sized(&slab, sizes[idx], &object);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(expected_class_sizes[idx], test_get_object_class_size(&fixture, object));
+
+        ret = slab_allocator_deallocate(&slab, &object);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(NULL, object);
+    }
+
+    ret = slab_allocator_allocate_sized(&slab, TEST_MAX_OBJECT_SIZE + 1, &object);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    assert_int_equal(8, slab_allocator_get_available_count(&slab));
+
+    slab_allocator_deinit(&slab);
+}
+
+static void test_exhausted_class_uses_larger_class(void ** state)
+{
+    (void)state;
+
+    TestSlabFixture_t fixture;
+    SlabAllocatorConfig_t config = test_get_config(&fixture);
+    SlabAllocator_t slab;
+    void * objects[8] = {};
+    void * object = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, slab_allocator_init(&slab, &config));
+
+    // 4 small objects, then the 32 and 64 byte classes take the overflow
+    size_t const expected_class_sizes[] = {8, 8, 8, 8, 32, 32, 64, 64};
+    for (size_t idx = 0; idx < 8; ++idx)
+    {
+        ret = slab_allocator_allocate_sized(&slab, 4, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(expected_class_sizes[idx], test_get_object_class_size(&fixture, objects[idx]));
+        assert_int_equal(7 - idx, slab_allocator_get_available_count(&slab));
+    }
+
+    ret = slab_allocator_allocate_sized(&slab, 4, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // pointers outside of every region are rejected
+    object = &fixture.buffer[TEST_BUFFER_SIZE];
+    ret = slab_allocator_deallocate(&slab, &object);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+    object = NULL;
+    ret = slab_allocator_deallocate(&slab, &object);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    for (size_t idx = 0; idx < 8; ++idx)
+    {
+        ret = slab_allocator_deallocate(&slab, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(idx + 1, slab_allocator_get_available_count(&slab));
+    }
+
+    slab_allocator_deinit(&slab);
+
+    ret = slab_allocator_allocate_sized(&slab, 4, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    ret = slab_allocator_allocate(&slab, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, slab_allocator_get_available_count(&slab));
+}
+
+int test_slab_allocator_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_interface),
+        cmocka_unit_test(test_invalid_configs),
+        cmocka_unit_test(test_size_class_selection),
+        cmocka_unit_test(test_exhausted_class_uses_larger_class),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+int test_slab_allocator_run_tests(void);
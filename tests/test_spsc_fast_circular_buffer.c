@@ -0,0 +1,250 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/spsc_fast_circular_buffer.h>
+#include "test_spsc_fast_circular_buffer.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#define ITEMS_IN_TEST_BUFFER (16)
+#define ITEMS_IN_THREADED_TEST (1u << 18)
+
+static void test_fills_then_rejects(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    FastCircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    SpscFastCircularBuffer_t circular;
+    ErrorCode_t result;
+    uint8_t byte_out;
+
+    result = spsc_fast_circular_buffer_init(&circular, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    result = spsc_fast_circular_buffer_pop_byte(&circular, &byte_out);
+    assert_int_equal(ERR_EMPTY, result);
+
+    for (uint8_t idx = 0; idx < ITEMS_IN_TEST_BUFFER; ++idx)
+    {
+        result = spsc_fast_circular_buffer_push_byte(&circular, idx);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(idx + 1, spsc_fast_circular_buffer_get_count(&circular));
+    }
+
+    // unlike the single threaded buffer, the oldest value is never overridden
+    result = spsc_fast_circular_buffer_push_byte(&circular, 0xFF);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    for (uint8_t idx = 0; idx < ITEMS_IN_TEST_BUFFER; ++idx)
+    {
+        result = spsc_fast_circular_buffer_pop_byte(&circular, &byte_out);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(idx, byte_out);
+    }
+
+    result = spsc_fast_circular_buffer_pop_byte(&circular, &byte_out);
+    assert_int_equal(ERR_EMPTY, result);
+}
+
+static void test_block_push_pop_wraps(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    FastCircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    SpscFastCircularBuffer_t circular;
+    ErrorCode_t result;
+    uint8_t input[ITEMS_IN_TEST_BUFFER * 2];
+    uint8_t output[ITEMS_IN_TEST_BUFFER * 2];
+    size_t count;
+
+    for (uint8_t idx = 0; idx < sizeof(input); ++idx)
+    {
+        input[idx] = idx;
+    }
+
+    result = spsc_fast_circular_buffer_init(&circular, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    count = spsc_fast_circular_buffer_push(&circular, input, 12);
+    assert_int_equal(12, count);
+    count = spsc_fast_circular_buffer_pop(&circular, output, 10);
+    assert_int_equal(10, count);
+    assert_memory_equal(input, output, 10);
+
+    // only 14 bytes of space are left, the rest of the block is rejected
+    count = spsc_fast_circular_buffer_push(&circular, &input[12], 20);
+    assert_int_equal(14, count);
+    assert_int_equal(ITEMS_IN_TEST_BUFFER, spsc_fast_circular_buffer_get_count(&circular));
+
+    count = spsc_fast_circular_buffer_pop(&circular, output, sizeof(output));
+    assert_int_equal(ITEMS_IN_TEST_BUFFER, count);
+    assert_memory_equal(&input[10], output, ITEMS_IN_TEST_BUFFER);
+
+    count = spsc_fast_circular_buffer_pop(&circular, output, sizeof(output));
+    assert_int_equal(0, count);
+}
+
+typedef struct TestSpscThreadArgs TestSpscThreadArgs_t;
+
+struct TestSpscThreadArgs
+{
+    SpscFastCircularBuffer_t * circular;
+    size_t errors;
+};
+
+static void * test_spsc_producer(void * context)
+{
+    TestSpscThreadArgs_t * args = context;
+    uint8_t block[7];
+    uint32_t next = 0;
+
+    // alternate between block and single byte pushes to exercise both paths
+    while (next < ITEMS_IN_THREADED_TEST)
+    {
+        if ((next & 1) == 0)
+        {
+            size_t length = ((ITEMS_IN_THREADED_TEST - next) < sizeof(block)) ? (ITEMS_IN_THREADED_TEST - next) : sizeof(block);
+            for (size_t idx = 0; idx < length; ++idx)
+            {
+                block[idx] = (uint8_t)(next + idx);
+            }
+            size_t count = spsc_fast_circular_buffer_push(args->circular, block, length);
+            if (count == 0) sched_yield();
+            next += (uint32_t)count;
+        }
+        else if (spsc_fast_circular_buffer_push_byte(args->circular, (uint8_t)next) == ERR_NONE)
+        {
+            next++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void * test_spsc_consumer(void * context)
+{
+    TestSpscThreadArgs_t * args = context;
+    uint8_t block[5];
+    uint32_t next = 0;
+
+    while (next < ITEMS_IN_THREADED_TEST)
+    {
+        size_t count = spsc_fast_circular_buffer_pop(args->circular, block, sizeof(block));
+        if (count == 0) sched_yield();
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            if (block[idx] != (uint8_t)next) args->errors++;
+            next++;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * A producer and consumer on separate threads must see every byte exactly once and in order.
+ */
+static void test_threaded_ordering(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    FastCircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    SpscFastCircularBuffer_t circular;
+    ErrorCode_t result;
+    TestSpscThreadArgs_t args = {
+        .circular = &circular,
+        .errors = 0,
+    };
+    pthread_t producer;
+    pthread_t consumer;
+
+    result = spsc_fast_circular_buffer_init(&circular, &config);
+    assert_int_equal(ERR_NONE, result);
+
+    assert_int_equal(0, pthread_create(&consumer, NULL, test_spsc_consumer, &args));
+    assert_int_equal(0, pthread_create(&producer, NULL, test_spsc_producer, &args));
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    assert_int_equal(0, args.errors);
+    assert_int_equal(0, spsc_fast_circular_buffer_get_count(&circular));
+}
+
+static void test_bad_config(void ** state)
+{
+    (void)state;
+
+    static uint8_t buffer[ITEMS_IN_TEST_BUFFER];
+    FastCircularBufferConfig_t config = {
+        .buffer = buffer,
+        .buffer_size = ITEMS_IN_TEST_BUFFER,
+    };
+    SpscFastCircularBuffer_t circular;
+    ErrorCode_t result;
+    FastCircularBufferConfig_t test_config = config;
+
+    test_config.buffer_size = 0;
+    result = spsc_fast_circular_buffer_init(&circular, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    test_config.buffer_size = 1;
+    result = spsc_fast_circular_buffer_init(&circular, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+
+    test_config.buffer_size = ITEMS_IN_TEST_BUFFER - 1;
+    result = spsc_fast_circular_buffer_init(&circular, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, result);
+}
+
+static void test_deinit_prevents_actions(void ** state)
+{
+    (void)state;
+
+    SpscFastCircularBuffer_t circular;
+    ErrorCode_t result;
+    uint8_t dummy = 0;
+
+    spsc_fast_circular_buffer_deinit(&circular);
+
+    result = spsc_fast_circular_buffer_push_byte(&circular, dummy);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    assert_int_equal(0, spsc_fast_circular_buffer_push(&circular, &dummy, 1));
+    assert_int_equal(0, spsc_fast_circular_buffer_get_count(&circular));
+
+    result = spsc_fast_circular_buffer_pop_byte(&circular, &dummy);
+    assert_int_equal(ERR_EMPTY, result);
+
+    assert_int_equal(0, spsc_fast_circular_buffer_pop(&circular, &dummy, 1));
+}
+
+int test_spsc_fast_circular_buffer_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_fills_then_rejects),
+        cmocka_unit_test(test_block_push_pop_wraps),
+        cmocka_unit_test(test_threaded_ordering),
+        cmocka_unit_test(test_bad_config),
+        cmocka_unit_test(test_deinit_prevents_actions),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+int test_spsc_fast_circular_buffer_run_tests(void);
@@ -50,6 +50,9 @@ static void test_correct_interface(void ** state)
     assert_ptr_equal(interface.allocate, static_pool_allocate);
     assert_ptr_equal(interface.deallocate, static_pool_deallocate);
     assert_ptr_equal(interface.get_available_count, static_pool_get_available_count);
+    assert_ptr_equal(NULL, interface.allocate_sized);
+    assert_ptr_equal(interface.allocate_bulk, static_pool_allocate_bulk);
+    assert_ptr_equal(interface.deallocate_bulk, static_pool_deallocate_bulk);
 }
 
 static void test_invalid_configs(void ** state)
@@ -75,6 +78,26 @@ static void test_invalid_configs(void ** state)
     ret = static_pool_init(&pool, &config);
     assert_int_equal(ERR_INVALID_ARG, ret);
     config.buffer_size = sizeof(buffer);
+
+    // alignment must be a power of 2, and the stride must fit an object on an alignment boundary
+    config.alignment = 3;
+    ret = static_pool_init(&pool, &config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    config.alignment = 0;
+    config.stride = TEST_OBJECT_SIZE_BYTES - 1;
+    ret = static_pool_init(&pool, &config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    config.alignment = 8;
+    config.stride = 12;
+    ret = static_pool_init(&pool, &config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    // the padded objects no longer fit
+    config.stride = 16;
+    ret = static_pool_init(&pool, &config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
 }
 
 static void test_deallocate_twice_fails(void ** state)
@@ -192,6 +215,244 @@ static void test_allocation_fills_and_unfills_correctly(void ** state)
     static_pool_deinit(&pool);
 }
 
+static void test_intrusive_free_list(void ** state)
+{
+    (void)state;
+
+    ErrorCode_t ret;
+    void * buffer[TEST_OBJECT_COUNT] = {};
+    void * object_pointers[TEST_OBJECT_COUNT] = {};
+    void * token = NULL;
+
+    StaticPoolConfig_t config = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .allocation_stack = NULL,
+        .object_count = TEST_OBJECT_COUNT,
+        .object_size = sizeof(void *),
+    };
+
+    StaticPool_t pool;
+
+    // objects must be able to hold the free list link
+    config.object_size = sizeof(void *) - 1;
+    ret = static_pool_init(&pool, &config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+    config.object_size = sizeof(void *);
+
+    ret = static_pool_init(&pool, &config);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(TEST_OBJECT_COUNT, static_pool_get_available_count(&pool));
+
+    // nothing has been allocated, so there is nothing to free
+    token = &buffer[0];
+    ret = static_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = static_pool_allocate(&pool, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_equal(&buffer[idx], object_pointers[idx]);
+        assert_int_equal(TEST_OBJECT_COUNT - 1 - idx, static_pool_get_available_count(&pool));
+    }
+
+    ret = static_pool_allocate(&pool, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // pointers outside of the buffer are rejected
+    token = &buffer[TEST_OBJECT_COUNT];
+    ret = static_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    // freed objects are reused most recent first
+    ret = static_pool_deallocate(&pool, &object_pointers[3]);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(NULL, object_pointers[3]);
+    ret = static_pool_deallocate(&pool, &object_pointers[7]);
+    assert_int_equal(ERR_NONE, ret);
+    assert_int_equal(2, static_pool_get_available_count(&pool));
+
+    ret = static_pool_allocate(&pool, &object_pointers[7]);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&buffer[7], object_pointers[7]);
+    ret = static_pool_allocate(&pool, &object_pointers[3]);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(&buffer[3], object_pointers[3]);
+
+    for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+    {
+        ret = static_pool_deallocate(&pool, &object_pointers[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(idx + 1, static_pool_get_available_count(&pool));
+    }
+
+    // every object is free, so a stale pointer cannot be freed again
+    token = &buffer[0];
+    ret = static_pool_deallocate(&pool, &token);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    static_pool_deinit(&pool);
+
+    ret = static_pool_allocate(&pool, &token);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, static_pool_get_available_count(&pool));
+}
+
+static void test_bulk_allocate_deallocate(void ** state)
+{
+    (void)state;
+
+    ErrorCode_t ret;
+    void * buffer[TEST_OBJECT_COUNT] = {};
+    void * allocation_stack[TEST_OBJECT_COUNT];
+    void * object_pointers[TEST_OBJECT_COUNT] = {};
+
+    StaticPoolConfig_t config = {
+        .buffer = (uint8_t *)buffer,
+        .buffer_size = sizeof(buffer),
+        .allocation_stack = allocation_stack,
+        .object_count = TEST_OBJECT_COUNT,
+        .object_size = sizeof(void *),
+    };
+
+    StaticPool_t pool;
+
+    // the same sequence for both the stack and intrusive modes
+    for (size_t mode = 0; mode < 2; ++mode)
+    {
+        config.allocation_stack = (mode == 0) ? allocation_stack : NULL;
+        ret = static_pool_init(&pool, &config);
+        assert_int_equal(ERR_NONE, ret);
+
+        ret = static_pool_allocate_bulk(&pool, object_pointers, 10);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(TEST_OBJECT_COUNT - 10, static_pool_get_available_count(&pool));
+
+        // a request larger than what is left takes nothing
+        ret = static_pool_allocate_bulk(&pool, &object_pointers[10], TEST_OBJECT_COUNT - 9);
+        assert_int_equal(ERR_NO_MEM, ret);
+        assert_int_equal(TEST_OBJECT_COUNT - 10, static_pool_get_available_count(&pool));
+
+        ret = static_pool_allocate_bulk(&pool, &object_pointers[10], TEST_OBJECT_COUNT - 10);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(0, static_pool_get_available_count(&pool));
+
+        // every object is handed out exactly once
+        for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+        {
+            for (size_t other = idx + 1; other < TEST_OBJECT_COUNT; ++other)
+            {
+                assert_ptr_not_equal(object_pointers[idx], object_pointers[other]);
+            }
+        }
+
+        ret = static_pool_deallocate_bulk(&pool, object_pointers, TEST_OBJECT_COUNT);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(TEST_OBJECT_COUNT, static_pool_get_available_count(&pool));
+        for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+        {
+            assert_ptr_equal(NULL, object_pointers[idx]);
+        }
+
+        // freeing already freed pointers is rejected
+        ret = static_pool_deallocate_bulk(&pool, object_pointers, 2);
+        assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+        assert_int_equal(TEST_OBJECT_COUNT, static_pool_get_available_count(&pool));
+
+        // a NULL in the batch is reported, but the valid objects around it are still freed
+        ret = static_pool_allocate_bulk(&pool, object_pointers, 4);
+        assert_int_equal(ERR_NONE, ret);
+        object_pointers[1] = NULL;
+        ret = static_pool_deallocate_bulk(&pool, object_pointers, 4);
+        assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+        assert_int_equal(TEST_OBJECT_COUNT - 1, static_pool_get_available_count(&pool));
+        for (size_t idx = 0; idx < 4; ++idx)
+        {
+            assert_ptr_equal(NULL, object_pointers[idx]);
+        }
+
+        static_pool_deinit(&pool);
+    }
+}
+
+static void test_aligned_placement(void ** state)
+{
+    (void)state;
+
+    ErrorCode_t ret;
+    size_t const object_size = 20;
+    size_t const alignment = 64;
+    _Alignas(64) uint8_t buffer[STATIC_POOL_BUFFER_SIZE(20, TEST_OBJECT_COUNT, 64) + 1];
+    void * allocation_stack[TEST_OBJECT_COUNT] = {};
+    void * object_pointers[TEST_OBJECT_COUNT] = {};
+
+    assert_int_equal(64, STATIC_POOL_STRIDE(object_size, alignment));
+    assert_int_equal((64 * TEST_OBJECT_COUNT) + 63, STATIC_POOL_BUFFER_SIZE(object_size, TEST_OBJECT_COUNT, alignment));
+
+    for (size_t mode = 0; mode < 2; ++mode)
+    {
+        // start one byte in so the pool has to skip to the next boundary
+        StaticPoolConfig_t config = {
+            .buffer = &buffer[1],
+            .buffer_size = sizeof(buffer) - 1,
+            .allocation_stack = (mode == 0) ? allocation_stack : NULL,
+            .object_count = TEST_OBJECT_COUNT,
+            .object_size = object_size,
+            .alignment = alignment,
+        };
+
+        StaticPool_t pool;
+
+        ret = static_pool_init(&pool, &config);
+        assert_int_equal(ERR_NONE, ret);
+
+        for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+        {
+            ret = static_pool_allocate(&pool, &object_pointers[idx]);
+            assert_int_equal(ERR_NONE, ret);
+            assert_int_equal(0, (uintptr_t)object_pointers[idx] % alignment);
+            assert_true((uint8_t *)object_pointers[idx] >= &buffer[alignment]);
+            assert_true(((uint8_t *)object_pointers[idx] + object_size) <= &buffer[sizeof(buffer)]);
+
+            // aligned objects are a whole stride apart, so each one is distinct
+            for (size_t other = 0; other < idx; ++other)
+            {
+                assert_ptr_not_equal(object_pointers[other], object_pointers[idx]);
+            }
+        }
+
+        ret = static_pool_allocate(&pool, &object_pointers[0]);
+        assert_int_equal(ERR_NO_MEM, ret);
+
+        for (size_t idx = 0; idx < TEST_OBJECT_COUNT; ++idx)
+        {
+            ret = static_pool_deallocate(&pool, &object_pointers[idx]);
+            assert_int_equal(ERR_NONE, ret);
+        }
+        assert_int_equal(TEST_OBJECT_COUNT, static_pool_get_available_count(&pool));
+
+        // an explicit stride wider than the alignment spreads the objects further apart
+        config.stride = 2 * alignment;
+        ret = static_pool_init(&pool, &config);
+        assert_int_equal(ERR_INVALID_ARG, ret);
+
+        config.object_count = TEST_OBJECT_COUNT / 2;
+        ret = static_pool_init(&pool, &config);
+        assert_int_equal(ERR_NONE, ret);
+
+        void * first = NULL;
+        void * second = NULL;
+        assert_int_equal(ERR_NONE, static_pool_allocate(&pool, &first));
+        assert_int_equal(ERR_NONE, static_pool_allocate(&pool, &second));
+        size_t distance = ((uint8_t *)first > (uint8_t *)second) ? (size_t)((uint8_t *)first - (uint8_t *)second) :
+                                                                     (size_t)((uint8_t *)second - (uint8_t *)first);
+        assert_int_equal(2 * alignment, distance);
+
+        static_pool_deinit(&pool);
+    }
+}
+
 int test_static_pool_run_tests(void)
 {
     const struct CMUnitTest tests[] = {
@@ -199,6 +460,9 @@ int test_static_pool_run_tests(void)
         cmocka_unit_test(test_invalid_configs),
         cmocka_unit_test(test_allocation_fills_and_unfills_correctly),
         cmocka_unit_test(test_deallocate_twice_fails),
+        cmocka_unit_test(test_intrusive_free_list),
+        cmocka_unit_test(test_bulk_allocate_deallocate),
+        cmocka_unit_test(test_aligned_placement),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
\ No newline at end of file
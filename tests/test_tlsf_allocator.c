@@ -0,0 +1,277 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/tlsf_allocator.h>
+#include "test_tlsf_allocator.h"
+
+#include <string.h>
+
+#define TEST_BUFFER_SIZE (4096)
+
+static _Alignas(TLSF_ALLOCATOR_ALIGN_SIZE) uint8_t test_buffer[TEST_BUFFER_SIZE];
+
+static TlsfAllocatorConfig_t test_get_config(void)
+{
+    TlsfAllocatorConfig_t config = {
+        .buffer = test_buffer,
+        .buffer_size = sizeof(test_buffer),
+    };
+    return config;
+}
+
+static void test_correct_interface(void ** state)
+{
+    (void)state;
+
+    TlsfAllocatorConfig_t config = test_get_config();
+    TlsfAllocator_t tlsf;
+    IPoolAllocator_t interface;
+    void * object = NULL;
+
+    assert_int_equal(ERR_NONE, tlsf_allocator_init(&tlsf, &config));
+
+    ErrorCode_t ret = tlsf_allocator_as_i_pool_allocator(&tlsf, &interface);
+    assert_int_equal(ERR_NONE, ret);
+
+    assert_ptr_equal(interface.context, &tlsf);
+    assert_ptr_equal(interface.deallocate, tlsf_allocator_deallocate);
+    assert_ptr_equal(interface.get_available_count, tlsf_allocator_get_free_bytes);
+    assert_ptr_equal(interface.allocate_sized, tlsf_allocator_allocate);
+
+    // there is no natural object size, so without a default size only sized requests are served
+    ret = i_pool_allocator_allocate(&interface, &object);
+    assert_int_equal(ERR_NOT_IMPLEMENTED, ret);
+
+    ret = i_pool_allocator_allocate_sized(&interface, 100, &object);
+    assert_int_equal(ERR_NONE, ret);
+    ret = i_pool_allocator_deallocate(&interface, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(NULL, object);
+
+    tlsf_allocator_deinit(&tlsf);
+}
+
+static void test_unsized_allocate_uses_default_size(void ** state)
+{
+    (void)state;
+
+    TlsfAllocatorConfig_t config = test_get_config();
+    TlsfAllocator_t tlsf;
+    IPoolAllocator_t interface;
+    TlsfAllocatorStats_t stats;
+    void * objects[2] = {};
+    ErrorCode_t ret;
+
+    config.default_size = 100;
+    assert_int_equal(ERR_NONE, tlsf_allocator_init(&tlsf, &config));
+    assert_int_equal(ERR_NONE, tlsf_allocator_as_i_pool_allocator(&tlsf, &interface));
+
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        ret = i_pool_allocator_allocate(&interface, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_ptr_not_equal(NULL, objects[idx]);
+        memset(objects[idx], 0xA5, config.default_size);
+    }
+
+    tlsf_allocator_get_stats(&tlsf, &stats);
+    assert_int_equal(2, stats.used_block_count);
+    assert_true(stats.used_bytes >= (2 * config.default_size));
+
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        ret = i_pool_allocator_deallocate(&interface, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+
+    tlsf_allocator_get_stats(&tlsf, &stats);
+    assert_int_equal(0, stats.used_block_count);
+
+    tlsf_allocator_deinit(&tlsf);
+}
+
+static void test_invalid_configs(void ** state)
+{
+    (void)state;
+
+    TlsfAllocatorConfig_t config = test_get_config();
+    TlsfAllocatorConfig_t test_config;
+    TlsfAllocator_t tlsf;
+    ErrorCode_t ret;
+
+    test_config = config;
+    test_config.buffer = &test_buffer[1];
+    test_config.buffer_size = TEST_BUFFER_SIZE - 1;
+    ret = tlsf_allocator_init(&tlsf, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    test_config = config;
+    test_config.buffer_size = 16;
+    ret = tlsf_allocator_init(&tlsf, &test_config);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+}
+
+static void test_allocations_are_aligned_and_disjoint(void ** state)
+{
+    (void)state;
+
+    TlsfAllocatorConfig_t config = test_get_config();
+    TlsfAllocator_t tlsf;
+    void * objects[16] = {};
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, tlsf_allocator_init(&tlsf, &config));
+    size_t initial_free_bytes = tlsf_allocator_get_free_bytes(&tlsf);
+
+    ret = tlsf_allocator_allocate(&tlsf, 0, &objects[0]);
+    assert_int_equal(ERR_INVALID_ARG, ret);
+
+    // fill each allocation with its index, any overlap would corrupt a neighbour
+    for (size_t idx = 0; idx < 16; ++idx)
+    {
+        size_t size = (idx * 13) + 1;
+        ret = tlsf_allocator_allocate(&tlsf, size, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+        assert_int_equal(0, (uintptr_t)objects[idx] % TLSF_ALLOCATOR_ALIGN_SIZE);
+        assert_true((uint8_t *)objects[idx] >= test_buffer);
+        assert_true(((uint8_t *)objects[idx] + size) <= &test_buffer[TEST_BUFFER_SIZE]);
+        memset(objects[idx], (int)idx, size);
+    }
+
+    for (size_t idx = 0; idx < 16; ++idx)
+    {
+        uint8_t * bytes = objects[idx];
+        for (size_t byte = 0; byte < (idx * 13) + 1; ++byte)
+        {
+            assert_int_equal(idx, bytes[byte]);
+        }
+    }
+
+    // free in an interleaved order so both neighbour merges are exercised
+    for (size_t idx = 0; idx < 16; idx += 2)
+    {
+        ret = tlsf_allocator_deallocate(&tlsf, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+    for (size_t idx = 1; idx < 16; idx += 2)
+    {
+        ret = tlsf_allocator_deallocate(&tlsf, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+
+    // everything merged back into a single block
+    TlsfAllocatorStats_t stats;
+    tlsf_allocator_get_stats(&tlsf, &stats);
+    assert_int_equal(initial_free_bytes, tlsf_allocator_get_free_bytes(&tlsf));
+    assert_int_equal(initial_free_bytes, stats.free_bytes);
+    assert_int_equal(initial_free_bytes, stats.largest_free_block);
+    assert_int_equal(1, stats.free_block_count);
+    assert_int_equal(0, stats.used_block_count);
+    assert_int_equal(0, stats.fragmentation_percent);
+
+    tlsf_allocator_deinit(&tlsf);
+}
+
+static void test_exhaustion_and_coalescing(void ** state)
+{
+    (void)state;
+
+    TlsfAllocatorConfig_t config = test_get_config();
+    TlsfAllocator_t tlsf;
+    void * objects[64] = {};
+    void * object = NULL;
+    size_t count = 0;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, tlsf_allocator_init(&tlsf, &config));
+
+    ret = tlsf_allocator_allocate(&tlsf, TEST_BUFFER_SIZE, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    while ((count < 64) && (tlsf_allocator_allocate(&tlsf, 120, &objects[count]) == ERR_NONE))
+    {
+        count++;
+    }
+    assert_true(count > 16);
+    assert_true(count < 64);
+
+    ret = tlsf_allocator_allocate(&tlsf, 120, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // freeing every other block leaves plenty of free space, but none of it contiguous
+    void * first_object = objects[0];
+    for (size_t idx = 0; idx < count; idx += 2)
+    {
+        ret = tlsf_allocator_deallocate(&tlsf, &objects[idx]);
+        assert_int_equal(ERR_NONE, ret);
+    }
+
+    TlsfAllocatorStats_t stats;
+    tlsf_allocator_get_stats(&tlsf, &stats);
+    assert_int_equal(stats.free_bytes, tlsf_allocator_get_free_bytes(&tlsf));
+    assert_true(stats.free_block_count >= count / 2);
+    assert_int_equal(count / 2, stats.used_block_count);
+    assert_true(stats.fragmentation_percent > 50);
+
+    ret = tlsf_allocator_allocate(&tlsf, 256, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+
+    // freeing one neighbour merges three blocks into a block large enough
+    ret = tlsf_allocator_deallocate(&tlsf, &objects[1]);
+    assert_int_equal(ERR_NONE, ret);
+    ret = tlsf_allocator_allocate(&tlsf, 256, &object);
+    assert_int_equal(ERR_NONE, ret);
+    assert_ptr_equal(first_object, object);
+
+    tlsf_allocator_deinit(&tlsf);
+}
+
+static void test_invalid_deallocations(void ** state)
+{
+    (void)state;
+
+    TlsfAllocatorConfig_t config = test_get_config();
+    TlsfAllocator_t tlsf;
+    void * object = NULL;
+    void * copy = NULL;
+    ErrorCode_t ret;
+
+    assert_int_equal(ERR_NONE, tlsf_allocator_init(&tlsf, &config));
+
+    ret = tlsf_allocator_deallocate(&tlsf, &object);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    object = &test_buffer[TEST_BUFFER_SIZE];
+    ret = tlsf_allocator_deallocate(&tlsf, &object);
+    assert_int_equal(ERR_OUT_OF_BOUNDS, ret);
+
+    ret = tlsf_allocator_allocate(&tlsf, 32, &object);
+    assert_int_equal(ERR_NONE, ret);
+    copy = object;
+    ret = tlsf_allocator_deallocate(&tlsf, &object);
+    assert_int_equal(ERR_NONE, ret);
+    ret = tlsf_allocator_deallocate(&tlsf, &copy);
+    assert_int_equal(ERR_INVALID_STATE, ret);
+
+    tlsf_allocator_deinit(&tlsf);
+
+    ret = tlsf_allocator_allocate(&tlsf, 32, &object);
+    assert_int_equal(ERR_NO_MEM, ret);
+    assert_int_equal(0, tlsf_allocator_get_free_bytes(&tlsf));
+}
+
+int test_tlsf_allocator_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_interface),
+        cmocka_unit_test(test_unsized_allocate_uses_default_size),
+        cmocka_unit_test(test_invalid_configs),
+        cmocka_unit_test(test_allocations_are_aligned_and_disjoint),
+        cmocka_unit_test(test_exhaustion_and_coalescing),
+        cmocka_unit_test(test_invalid_deallocations),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
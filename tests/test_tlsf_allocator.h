@@ -0,0 +1,3 @@
+#pragma once
+
+int test_tlsf_allocator_run_tests(void);
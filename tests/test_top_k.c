@@ -0,0 +1,156 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include "test_top_k.h"
+#include <cemb/top_k.h>
+
+#define TEST_K (10)
+#define TEST_STREAM_LENGTH (1000)
+#define TEST_VALUE_RANGE (200)
+
+typedef struct TestFlow TestFlow_t;
+
+/**
+ * @brief A flow as the selector sees it, ranked by byte count.
+ */
+struct TestFlow
+{
+    uint32_t byte_count;
+    uint32_t id;
+};
+
+static bool flow_ranks_above(void const * const first, void const * const second)
+{
+    return ((TestFlow_t const *)first)->byte_count > ((TestFlow_t const *)second)->byte_count;
+}
+
+static void test_init_top_k(TopK_t * top_k, void ** heap_storage, size_t k)
+{
+    TopKConfig_t config = {
+        .heap_storage = heap_storage,
+        .k = k,
+        .ranks_above = flow_ranks_above,
+    };
+    assert_int_equal(ERR_NONE, top_k_init(top_k, &config));
+}
+
+static void test_bad_init(void ** state)
+{
+    (void)state;
+
+    void * heap_storage[TEST_K];
+    TopK_t top_k;
+    TopKConfig_t config = {
+        .heap_storage = heap_storage,
+        .k = 0,
+        .ranks_above = flow_ranks_above,
+    };
+
+    assert_int_equal(ERR_INVALID_ARG, top_k_init(&top_k, &config));
+}
+
+static void test_dropped_items(void ** state)
+{
+    (void)state;
+
+    void * heap_storage[2];
+    TestFlow_t flows[] = {{100, 0}, {50, 1}, {50, 2}, {75, 3}, {200, 4}};
+    TopK_t top_k;
+    void * dropped = (void *)&flows[0];
+    void * threshold = NULL;
+
+    test_init_top_k(&top_k, heap_storage, 2);
+
+    assert_int_equal(ERR_EMPTY, top_k_get_threshold(&top_k, &threshold));
+
+    // filling up drops nothing
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[0], &dropped));
+    assert_ptr_equal(NULL, dropped);
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[1], NULL));
+    assert_int_equal(2, top_k_get_size(&top_k));
+
+    assert_int_equal(ERR_NONE, top_k_get_threshold(&top_k, &threshold));
+    assert_ptr_equal(&flows[1], threshold);
+
+    // ties with the threshold are rejected, higher items evict it
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[2], &dropped));
+    assert_ptr_equal(&flows[2], dropped);
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[3], &dropped));
+    assert_ptr_equal(&flows[1], dropped);
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[4], &dropped));
+    assert_ptr_equal(&flows[3], dropped);
+    assert_int_equal(2, top_k_get_size(&top_k));
+
+    top_k_deinit(&top_k);
+
+    assert_int_equal(ERR_NO_MEM, top_k_offer(&top_k, &flows[4], &dropped));
+    assert_ptr_equal(&flows[4], dropped);
+    assert_int_equal(0, top_k_get_size(&top_k));
+}
+
+/**
+ * @brief Streams pseudo random flows through the selector and checks the emitted flows against a count of how many
+ *        flows had each byte count.
+ */
+static void test_stream_emits_sorted_top_k(void ** state)
+{
+    (void)state;
+
+    void * heap_storage[TEST_K];
+    void * emitted[TEST_K];
+    static TestFlow_t flows[TEST_STREAM_LENGTH];
+    size_t value_counts[TEST_VALUE_RANGE] = {};
+    uint32_t random_state = 0x2545f491u;
+    TopK_t top_k;
+    size_t count = 0;
+
+    test_init_top_k(&top_k, heap_storage, TEST_K);
+
+    for (size_t idx = 0; idx < TEST_STREAM_LENGTH; ++idx)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        flows[idx] = (TestFlow_t){(random_state >> 16) % TEST_VALUE_RANGE, (uint32_t)idx};
+        value_counts[flows[idx].byte_count]++;
+        assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[idx], NULL));
+    }
+
+    assert_int_equal(ERR_NONE, top_k_emit_sorted(&top_k, emitted, &count));
+    assert_int_equal(TEST_K, count);
+    assert_int_equal(0, top_k_get_size(&top_k));
+
+    // walk the counts down from the highest value, the emitted flows must follow them exactly
+    size_t value = TEST_VALUE_RANGE;
+    for (size_t idx = 0; idx < TEST_K; ++idx)
+    {
+        while (value_counts[value - 1] == 0) value--;
+        value_counts[value - 1]--;
+        assert_int_equal(value - 1, ((TestFlow_t *)emitted[idx])->byte_count);
+    }
+
+    // emitting again and a partly filled stream
+    assert_int_equal(ERR_NONE, top_k_emit_sorted(&top_k, emitted, &count));
+    assert_int_equal(0, count);
+
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[0], NULL));
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[1], NULL));
+    assert_int_equal(ERR_NONE, top_k_offer(&top_k, &flows[2], NULL));
+    assert_int_equal(ERR_NONE, top_k_emit_sorted(&top_k, emitted, &count));
+    assert_int_equal(3, count);
+    assert_true(((TestFlow_t *)emitted[0])->byte_count >= ((TestFlow_t *)emitted[1])->byte_count);
+    assert_true(((TestFlow_t *)emitted[1])->byte_count >= ((TestFlow_t *)emitted[2])->byte_count);
+
+    top_k_deinit(&top_k);
+}
+
+int test_top_k_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_bad_init),
+        cmocka_unit_test(test_dropped_items),
+        cmocka_unit_test(test_stream_emits_sorted_top_k),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+int test_top_k_run_tests(void);
@@ -0,0 +1,119 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/typed_bounded_heap.h>
+#include "test_typed_bounded_heap.h"
+
+#define ITEMS_IN_TEST_HEAP (31)
+
+typedef struct TestPriority TestPriority_t;
+
+/**
+ * @brief A compound key, ordered by level then by sequence number.
+ */
+struct TestPriority
+{
+    uint8_t level;
+    uint32_t sequence;
+};
+
+CEMB_DEFINE_BOUNDED_HEAP(TestMinHeap, test_min_heap, uint32_t, size_t, ITEMS_IN_TEST_HEAP, (a) < (b))
+CEMB_DEFINE_BOUNDED_HEAP(TestPriorityHeap, test_priority_heap, TestPriority_t, uint32_t, 4,
+                         (a.level > b.level) || ((a.level == b.level) && (a.sequence < b.sequence)))
+
+static void test_min_heap_ordering(void ** state)
+{
+    (void)state;
+
+    TestMinHeap_t heap;
+    ErrorCode_t result;
+    uint32_t keys[ITEMS_IN_TEST_HEAP];
+    uint32_t key_state = 0x2545f491u;
+    uint32_t key;
+    size_t payload;
+
+    test_min_heap_init(&heap);
+
+    result = test_min_heap_peek(&heap, &key, &payload);
+    assert_int_equal(ERR_EMPTY, result);
+    result = test_min_heap_pop(&heap, &key, &payload);
+    assert_int_equal(ERR_EMPTY, result);
+
+    // unordered keys with some repeats, each payload is the index of its key
+    for (size_t idx = 0; idx < ITEMS_IN_TEST_HEAP; ++idx)
+    {
+        key_state = (key_state * 1103515245u) + 12345u;
+        keys[idx] = (key_state >> 16) % 20;
+        result = test_min_heap_push(&heap, keys[idx], idx);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(idx + 1, test_min_heap_get_size(&heap));
+        assert_int_equal(ITEMS_IN_TEST_HEAP - idx - 1, test_min_heap_get_remaining(&heap));
+    }
+
+    result = test_min_heap_push(&heap, 0, 0);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    uint32_t previous_key = 0;
+    for (size_t idx = 0; idx < ITEMS_IN_TEST_HEAP; ++idx)
+    {
+        uint32_t peek_key;
+        size_t peek_payload;
+        result = test_min_heap_peek(&heap, &peek_key, &peek_payload);
+        assert_int_equal(ERR_NONE, result);
+
+        result = test_min_heap_pop(&heap, &key, &payload);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(peek_key, key);
+        assert_int_equal(peek_payload, payload);
+        assert_true(key >= previous_key);
+        assert_int_equal(keys[payload], key);
+        previous_key = key;
+    }
+
+    assert_int_equal(0, test_min_heap_get_size(&heap));
+    result = test_min_heap_pop(&heap, &key, &payload);
+    assert_int_equal(ERR_EMPTY, result);
+
+    test_min_heap_deinit(&heap);
+
+    result = test_min_heap_push(&heap, 0, 0);
+    assert_int_equal(ERR_NO_MEM, result);
+}
+
+static void test_compound_key_ordering(void ** state)
+{
+    (void)state;
+
+    TestPriorityHeap_t heap;
+    TestPriority_t key;
+    uint32_t payload;
+
+    test_priority_heap_init(&heap);
+
+    // payloads are (level * 10) + sequence, higher levels first then first in first out within a level
+    assert_int_equal(ERR_NONE, test_priority_heap_push(&heap, (TestPriority_t){1, 0}, 10));
+    assert_int_equal(ERR_NONE, test_priority_heap_push(&heap, (TestPriority_t){3, 1}, 31));
+    assert_int_equal(ERR_NONE, test_priority_heap_push(&heap, (TestPriority_t){1, 2}, 12));
+    assert_int_equal(ERR_NONE, test_priority_heap_push(&heap, (TestPriority_t){3, 3}, 33));
+
+    uint32_t const expected[] = {31, 33, 10, 12};
+    for (size_t idx = 0; idx < 4; ++idx)
+    {
+        assert_int_equal(ERR_NONE, test_priority_heap_pop(&heap, &key, &payload));
+        assert_int_equal(expected[idx], payload);
+    }
+
+    test_priority_heap_deinit(&heap);
+}
+
+int test_typed_bounded_heap_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_min_heap_ordering),
+        cmocka_unit_test(test_compound_key_ordering),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
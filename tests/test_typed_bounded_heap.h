@@ -0,0 +1,3 @@
+#pragma once
+
+int test_typed_bounded_heap_run_tests(void);
@@ -0,0 +1,139 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <cemb/typed_copy_queue.h>
+#include "test_typed_copy_queue.h"
+
+#include <string.h>
+
+#define ITEMS_IN_TEST_QUEUE (15)
+
+typedef struct TestTypedRecord TestTypedRecord_t;
+
+struct TestTypedRecord
+{
+    uint32_t id;
+    uint8_t payload[28];
+};
+
+CEMB_DEFINE_COPY_QUEUE(TestIntQueue, test_int_queue, int, ITEMS_IN_TEST_QUEUE)
+CEMB_DEFINE_COPY_QUEUE(TestRecordQueue, test_record_queue, TestTypedRecord_t, 4)
+
+static void test_correct_fifo_ordering(void ** state)
+{
+    (void)state;
+
+    TestIntQueue_t queue;
+    ErrorCode_t result;
+    int next_in = 0;
+    int next_out = 0;
+    int output;
+
+    test_int_queue_init(&queue);
+
+    result = test_int_queue_peek(&queue, &output);
+    assert_int_equal(ERR_EMPTY, result);
+
+    // fill, then keep 4 in 3 out so the indexes wrap a few times
+    for (int idx = 0; idx < ITEMS_IN_TEST_QUEUE; ++idx)
+    {
+        result = test_int_queue_enqueue(&queue, &next_in);
+        assert_int_equal(ERR_NONE, result);
+        next_in++;
+        assert_int_equal(next_in, test_int_queue_get_size(&queue));
+        assert_int_equal(ITEMS_IN_TEST_QUEUE - next_in, test_int_queue_get_remaining(&queue));
+    }
+
+    result = test_int_queue_enqueue(&queue, &next_in);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    for (int cycle = 0; cycle < (ITEMS_IN_TEST_QUEUE * 3); ++cycle)
+    {
+        result = test_int_queue_peek(&queue, &output);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(next_out, output);
+
+        result = test_int_queue_dequeue(&queue, &output);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(next_out, output);
+        next_out++;
+
+        result = test_int_queue_enqueue(&queue, &next_in);
+        assert_int_equal(ERR_NONE, result);
+        next_in++;
+    }
+
+    while (test_int_queue_dequeue(&queue, &output) == ERR_NONE)
+    {
+        assert_int_equal(next_out, output);
+        next_out++;
+    }
+    assert_int_equal(next_in, next_out);
+}
+
+static void test_struct_elements_are_copied(void ** state)
+{
+    (void)state;
+
+    TestRecordQueue_t queue;
+    TestTypedRecord_t record;
+    TestTypedRecord_t output;
+    ErrorCode_t result;
+
+    test_record_queue_init(&queue);
+
+    for (uint32_t idx = 0; idx < 4; ++idx)
+    {
+        record.id = idx;
+        memset(record.payload, (int)idx, sizeof(record.payload));
+        result = test_record_queue_enqueue(&queue, &record);
+        assert_int_equal(ERR_NONE, result);
+    }
+
+    // changing the source after enqueue must not change the queued copy
+    memset(&record, 0xFF, sizeof(record));
+
+    for (uint32_t idx = 0; idx < 4; ++idx)
+    {
+        result = test_record_queue_dequeue(&queue, &output);
+        assert_int_equal(ERR_NONE, result);
+        assert_int_equal(idx, output.id);
+        assert_int_equal(idx, output.payload[sizeof(output.payload) - 1]);
+    }
+}
+
+static void test_deinit_prevents_actions(void ** state)
+{
+    (void)state;
+
+    TestIntQueue_t queue;
+    int dummy = 0;
+    ErrorCode_t result;
+
+    test_int_queue_deinit(&queue);
+
+    result = test_int_queue_enqueue(&queue, &dummy);
+    assert_int_equal(ERR_NO_MEM, result);
+
+    result = test_int_queue_peek(&queue, &dummy);
+    assert_int_equal(ERR_EMPTY, result);
+
+    result = test_int_queue_dequeue(&queue, &dummy);
+    assert_int_equal(ERR_EMPTY, result);
+
+    assert_int_equal(0, test_int_queue_get_remaining(&queue));
+    assert_int_equal(0, test_int_queue_get_size(&queue));
+}
+
+int test_typed_copy_queue_run_tests(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_correct_fifo_ordering),
+        cmocka_unit_test(test_struct_elements_are_copied),
+        cmocka_unit_test(test_deinit_prevents_actions),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
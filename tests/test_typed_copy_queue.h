@@ -0,0 +1,3 @@
+#pragma once
+
+int test_typed_copy_queue_run_tests(void);